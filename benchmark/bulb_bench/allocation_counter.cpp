@@ -0,0 +1,84 @@
+#include "allocation_counter.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+
+namespace {
+
+  std::atomic<std::size_t> allocation_count{0};
+  std::atomic<std::size_t> allocation_bytes{0};
+
+  auto counted_allocate(std::size_t size)
+    -> void*
+  {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) {
+      size = 1;
+    }
+    return std::malloc(size);
+  }
+
+} // namespace
+
+namespace bench {
+
+  auto allocation_snapshot() noexcept
+    -> allocation_stats
+  {
+    return allocation_stats{
+        allocation_count.load(std::memory_order_relaxed)
+      , allocation_bytes.load(std::memory_order_relaxed)
+    };
+  }
+
+} // namespace bench
+
+auto operator new(std::size_t const size)
+  -> void*
+{
+  if (auto const ptr = counted_allocate(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+auto operator new[](std::size_t const size)
+  -> void*
+{
+  return operator new(size);
+}
+
+auto operator new(std::size_t const size, std::nothrow_t const&) noexcept
+  -> void*
+{
+  return counted_allocate(size);
+}
+
+auto operator new[](std::size_t const size, std::nothrow_t const&) noexcept
+  -> void*
+{
+  return counted_allocate(size);
+}
+
+void operator delete(void* const ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* const ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* const ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
@@ -0,0 +1,20 @@
+#ifndef CANARD_NET_OFP_BENCHMARK_ALLOCATION_COUNTER_HPP
+#define CANARD_NET_OFP_BENCHMARK_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+namespace bench {
+
+  struct allocation_stats
+  {
+    std::size_t count;
+    std::size_t bytes;
+  };
+
+  // counts calls of the replaceable global operator new of this executable
+  auto allocation_snapshot() noexcept
+    -> allocation_stats;
+
+} // namespace bench
+
+#endif // CANARD_NET_OFP_BENCHMARK_ALLOCATION_COUNTER_HPP
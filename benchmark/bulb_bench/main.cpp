@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <canard/net/ofp/allocation_stats.hpp>
+#include <benchmark/benchmark.h>
+
+#include "message_benchmark.hpp"
+
+namespace {
+
+  void print_allocation_stats()
+  {
+    namespace ofp = canard::net::ofp;
+    std::fprintf(stderr, "%-60s %12s %16s %16s\n"
+        , "type", "allocations", "allocated_bytes", "peak_live_bytes");
+    ofp::for_each_allocation_stats(
+        [](char const* name, ofp::allocation_stats const& stats) {
+          std::fprintf(stderr, "%-60s %12zu %16zu %16zu\n"
+              , name, stats.allocations, stats.allocated_bytes
+              , stats.peak_live_bytes);
+        });
+  }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  bench::register_v10_messages();
+  bench::register_v13_messages();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  if (canard::net::ofp::allocation_stats_enabled) {
+    print_allocation_stats();
+  }
+  return 0;
+}
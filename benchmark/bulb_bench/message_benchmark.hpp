@@ -0,0 +1,162 @@
+#ifndef CANARD_NET_OFP_BENCHMARK_MESSAGE_BENCHMARK_HPP
+#define CANARD_NET_OFP_BENCHMARK_MESSAGE_BENCHMARK_HPP
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include "allocation_counter.hpp"
+
+namespace bench {
+
+  class allocation_scope
+  {
+  public:
+    explicit allocation_scope(benchmark::State& state) noexcept
+      : state_(state), start_(allocation_snapshot())
+    {
+    }
+
+    ~allocation_scope()
+    {
+      auto const last = allocation_snapshot();
+      state_.counters["allocs_per_op"] = benchmark::Counter(
+          double(last.count - start_.count), benchmark::Counter::kAvgIterations);
+      state_.counters["alloc_bytes_per_op"] = benchmark::Counter(
+          double(last.bytes - start_.bytes), benchmark::Counter::kAvgIterations);
+    }
+
+  private:
+    benchmark::State& state_;
+    allocation_stats start_;
+  };
+
+  template <class Message>
+  void set_message_rate(benchmark::State& state, Message const& msg)
+  {
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * msg.byte_length());
+  }
+
+  template <class Message>
+  void encode_message(benchmark::State& state, Message const& msg)
+  {
+    auto buffer = std::vector<unsigned char>{};
+    buffer.reserve(msg.byte_length());
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        buffer.clear();
+        msg.encode(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  template <class Message>
+  void decode_message(benchmark::State& state, Message const& msg)
+  {
+    auto buffer = std::vector<unsigned char>{};
+    msg.encode(buffer);
+    unsigned char const* const last = buffer.data() + buffer.size();
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        unsigned char const* it = buffer.data();
+        auto decoded = Message::decode(it, last);
+        benchmark::DoNotOptimize(decoded);
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  template <class Message>
+  void copy_message(benchmark::State& state, Message const& msg)
+  {
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        auto copy = msg;
+        benchmark::DoNotOptimize(copy);
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  template <class Message>
+  void move_message(benchmark::State& state, Message const& msg)
+  {
+    auto source = msg;
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        auto moved = std::move(source);
+        benchmark::DoNotOptimize(moved);
+        source = std::move(moved);
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  template <class Message>
+  void compare_message(benchmark::State& state, Message const& msg)
+  {
+    auto const copy = msg;
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(msg == copy);
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  template <class Message>
+  void compare_message_equivalence(benchmark::State& state, Message const& msg)
+  {
+    auto const copy = msg;
+    {
+      auto const scope = allocation_scope{state};
+      for (auto _ : state) {
+        benchmark::DoNotOptimize(equivalent(msg, copy));
+      }
+    }
+    set_message_rate(state, msg);
+  }
+
+  // registers "<name>/{encode,decode,copy,move,equal}"
+  template <class Message>
+  void register_message(std::string const& name, Message const& msg)
+  {
+    benchmark::RegisterBenchmark(
+        (name + "/encode").c_str(), encode_message<Message>, msg);
+    benchmark::RegisterBenchmark(
+        (name + "/decode").c_str(), decode_message<Message>, msg);
+    benchmark::RegisterBenchmark(
+        (name + "/copy").c_str(), copy_message<Message>, msg);
+    benchmark::RegisterBenchmark(
+        (name + "/move").c_str(), move_message<Message>, msg);
+    benchmark::RegisterBenchmark(
+        (name + "/equal").c_str(), compare_message<Message>, msg);
+  }
+
+  // only a part of messages implement equivalent
+  template <class Message>
+  void register_message_with_equivalence(
+      std::string const& name, Message const& msg)
+  {
+    register_message(name, msg);
+    benchmark::RegisterBenchmark(
+        (name + "/equivalent").c_str()
+      , compare_message_equivalence<Message>, msg);
+  }
+
+  void register_v10_messages();
+  void register_v13_messages();
+
+} // namespace bench
+
+#endif // CANARD_NET_OFP_BENCHMARK_MESSAGE_BENCHMARK_HPP
@@ -0,0 +1,177 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <boost/asio/ip/address_v4.hpp>
+#include <canard/mac_address.hpp>
+#include <canard/net/ofp/v10/actions.hpp>
+#include <canard/net/ofp/v10/messages.hpp>
+
+#include "message_benchmark.hpp"
+
+namespace bench {
+
+  namespace {
+
+    namespace v10 = canard::net::ofp::v10;
+    namespace msg = v10::messages;
+    namespace stats = msg::statistics;
+    namespace fields = v10::match_fields;
+    namespace actions = v10::actions;
+    namespace protocol = v10::protocol;
+    using boost::asio::ip::address_v4;
+
+    auto const eth1 = canard::mac_address{{{0x01, 0x02, 0x03, 0x04, 0x05, 0x06}}};
+    auto const eth2 = canard::mac_address{{{0x11, 0x12, 0x13, 0x14, 0x15, 0x16}}};
+
+    auto make_frame(std::size_t const size)
+      -> msg::packet_in::data_type
+    {
+      auto frame = msg::packet_in::data_type(size, 0xab);
+      for (auto i = std::size_t{0}; i < size; ++i) {
+        frame[i] = std::uint8_t(i);
+      }
+      return frame;
+    }
+
+    auto make_match(std::uint16_t const i)
+      -> v10::match
+    {
+      return v10::match{
+          fields::in_port{std::uint16_t(i % 48 + 1)}
+        , fields::eth_src{eth1}
+        , fields::eth_dst{eth2}
+        , fields::eth_type{0x0800}
+        , fields::ip_proto{6}
+        , fields::ipv4_src{address_v4{0x0a000000u + i}, 24}
+        , fields::ipv4_dst{address_v4{0x0a010000u + i}, 32}
+        , fields::tcp_dst{i}
+      };
+    }
+
+    auto make_action_list()
+      -> v10::action_list
+    {
+      return v10::action_list{
+          actions::set_vlan_vid{3}
+        , actions::set_eth_dst{eth2}
+        , actions::output{3}
+      };
+    }
+
+    auto make_port(std::uint16_t const port_no)
+      -> v10::port
+    {
+      auto const name = "eth" + std::to_string(port_no);
+      return v10::port{
+          port_no, eth1, name.c_str(), 0, 0
+        , protocol::OFPPF_1GB_FD | protocol::OFPPF_COPPER
+        , protocol::OFPPF_1GB_FD | protocol::OFPPF_COPPER
+        , protocol::OFPPF_1GB_FD | protocol::OFPPF_COPPER
+        , protocol::OFPPF_1GB_FD | protocol::OFPPF_COPPER
+      };
+    }
+
+    auto make_flow_stats_reply(std::size_t const num_entries)
+      -> stats::flow_stats_reply
+    {
+      auto body = stats::flow_stats_reply::body_type{};
+      body.reserve(num_entries);
+      for (auto i = std::uint16_t{0}; i < num_entries; ++i) {
+        body.push_back(stats::flow_stats{
+            v10::flow_entry{
+                {make_match(i), protocol::OFP_DEFAULT_PRIORITY}
+              , std::uint64_t{i}, v10::action_list{}
+            }
+          , 0, v10::timeouts{0, 0}, v10::elapsed_time{i, 0}
+          , v10::counters{i, i * 64u}
+        });
+      }
+      return stats::flow_stats_reply{std::move(body)};
+    }
+
+    auto make_port_stats_reply(std::size_t const num_ports)
+      -> stats::port_stats_reply
+    {
+      auto body = stats::port_stats_reply::body_type{};
+      for (auto i = std::uint16_t{0}; i < num_ports; ++i) {
+        body.push_back(stats::port_stats{
+            std::uint16_t(i + 1), i, i, i, i, 0, 0, 0, 0, 0, 0, 0, 0
+        });
+      }
+      return stats::port_stats_reply{std::move(body)};
+    }
+
+  } // namespace
+
+  void register_v10_messages()
+  {
+    auto ports = msg::features_reply::ports_type{};
+    for (auto i = std::uint16_t{1}; i <= 48; ++i) {
+      ports.push_back(make_port(i));
+    }
+
+    register_message("v10/error", msg::error{
+        protocol::bad_request_code::bad_type, msg::error::data_type(64, 0x1)
+    });
+    register_message(
+        "v10/echo_request", msg::echo_request{msg::echo_request::data_type(32)});
+    register_message(
+        "v10/echo_reply", msg::echo_reply{msg::echo_reply::data_type(32)});
+    register_message("v10/features_request", msg::features_request{});
+    register_message("v10/features_reply/48", msg::features_reply{
+        1, 256, 254, protocol::OFPC_FLOW_STATS, 0xfff, std::move(ports)
+    });
+    register_message("v10/get_config_request", msg::get_config_request{});
+    register_message(
+        "v10/get_config_reply", msg::get_config_reply{0, 0xffff});
+    register_message("v10/set_config", msg::set_config{0, 0xffff});
+    register_message("v10/packet_in/1500", msg::packet_in{
+        make_frame(1500), 1500, 3, protocol::OFPR_NO_MATCH, 0xffffffff
+    });
+    register_message("v10/flow_removed", msg::flow_removed{
+        make_match(1), protocol::OFP_DEFAULT_PRIORITY, 0
+      , protocol::OFPRR_IDLE_TIMEOUT, v10::elapsed_time{10, 0}, 10
+      , v10::counters{100, 6400}
+    });
+    register_message(
+        "v10/port_status", msg::port_status{protocol::OFPPR_MODIFY, make_port(1)});
+    register_message("v10/packet_out/1500", msg::packet_out{
+        make_frame(1500), protocol::OFPP_CONTROLLER, make_action_list()
+    });
+    register_message("v10/flow_add", msg::flow_add{
+        make_match(1), protocol::OFP_DEFAULT_PRIORITY, 0, make_action_list()
+      , v10::timeouts{0, 300}, protocol::OFPFF_SEND_FLOW_REM, 0xffffffff
+    });
+    register_message("v10/flow_delete", msg::flow_delete{
+        make_match(1), protocol::OFPP_NONE
+    });
+    register_message("v10/port_mod", msg::port_mod{
+        1, eth1, protocol::OFPPC_NO_FWD, protocol::OFPPC_NO_FWD, 0
+    });
+    register_message("v10/barrier_request", msg::barrier_request{});
+    register_message("v10/barrier_reply", msg::barrier_reply{0});
+    register_message(
+        "v10/queue_get_config_request", msg::queue_get_config_request{1});
+
+    register_message(
+        "v10/description_request", stats::description_request{});
+    register_message("v10/description_reply", stats::description_reply{
+        "manufacturer", "hardware", "software", "serial", "datapath"
+    });
+    register_message("v10/flow_stats_request", stats::flow_stats_request{
+        make_match(1), 0xff, protocol::OFPP_NONE
+    });
+    // 88 bytes per entry; 700 entries is close to the message size limit
+    register_message(
+        "v10/flow_stats_reply/700", make_flow_stats_reply(700));
+    register_message(
+        "v10/aggregate_stats_reply", stats::aggregate_stats_reply{
+            v10::counters{1000, 64000}, 1000
+    });
+    register_message(
+        "v10/port_stats_request", stats::port_stats_request{protocol::OFPP_NONE});
+    register_message("v10/port_stats_reply/48", make_port_stats_reply(48));
+  }
+
+} // namespace bench
@@ -0,0 +1,386 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <boost/asio/ip/address_v4.hpp>
+#include <canard/mac_address.hpp>
+#include <canard/net/ofp/v13/actions.hpp>
+#include <canard/net/ofp/v13/hello_elements.hpp>
+#include <canard/net/ofp/v13/instructions.hpp>
+#include <canard/net/ofp/v13/messages.hpp>
+#include <canard/net/ofp/v13/table_feature_properties.hpp>
+#include <canard/net/ofp/v13/utility/action_set.hpp>
+#include <canard/net/ofp/v13/utility/instruction_set.hpp>
+
+#include "message_benchmark.hpp"
+
+namespace bench {
+
+  namespace {
+
+    namespace v13 = canard::net::ofp::v13;
+    namespace msg = v13::messages;
+    namespace multipart = msg::multipart;
+    namespace fields = v13::oxm_match_fields;
+    namespace actions = v13::actions;
+    namespace instructions = v13::instructions;
+    namespace protocol = v13::protocol;
+    using boost::asio::ip::address_v4;
+
+    auto const eth1 = canard::mac_address{{{0x01, 0x02, 0x03, 0x04, 0x05, 0x06}}};
+    auto const eth2 = canard::mac_address{{{0x11, 0x12, 0x13, 0x14, 0x15, 0x16}}};
+
+    auto make_frame(std::size_t const size)
+      -> msg::packet_in::data_type
+    {
+      auto frame = msg::packet_in::data_type(size, 0xab);
+      for (auto i = std::size_t{0}; i < size; ++i) {
+        frame[i] = std::uint8_t(i);
+      }
+      return frame;
+    }
+
+    // cycles through the fields a flow classifier typically matches on
+    auto make_oxm_field(std::uint32_t const i)
+      -> v13::any_oxm_match_field
+    {
+      switch (i % 10) {
+      case 0: return fields::in_port{i + 1};
+      case 1: return fields::eth_dst{eth1};
+      case 2: return fields::eth_src{eth2};
+      case 3: return fields::eth_type{0x0800};
+      case 4: return fields::vlan_vid{std::uint16_t(protocol::OFPVID_PRESENT | i)};
+      case 5: return fields::ip_proto{6};
+      case 6: return fields::ipv4_src{address_v4{0x0a000000 + i}, 24};
+      case 7: return fields::ipv4_dst{address_v4{0x0a010000 + i}};
+      case 8: return fields::tcp_src{std::uint16_t(1024 + i)};
+      default: return fields::tcp_dst{std::uint16_t(i)};
+      }
+    }
+
+    auto make_oxm_match(std::size_t const num_fields)
+      -> v13::oxm_match
+    {
+      auto oxm_fields = v13::oxm_match::oxm_fields_type{};
+      for (auto i = std::size_t{0}; i < num_fields; ++i) {
+        oxm_fields.push_back(make_oxm_field(i));
+      }
+      return v13::oxm_match{std::move(oxm_fields)};
+    }
+
+    auto make_action_list()
+      -> v13::action_list
+    {
+      return v13::action_list{
+          actions::push_vlan{0x8100}
+        , actions::set_vlan_vid{protocol::OFPVID_PRESENT | 3}
+        , actions::set_eth_dst{eth2}
+        , actions::output{3}
+      };
+    }
+
+    auto make_action_set()
+      -> v13::action_set
+    {
+      return v13::action_set{
+          actions::push_vlan{0x8100}
+        , actions::set_vlan_vid{protocol::OFPVID_PRESENT | 3}
+        , actions::set_eth_dst{eth2}
+        , actions::output{3}
+      };
+    }
+
+    auto make_flow_entry(std::size_t const num_fields)
+      -> v13::flow_entry
+    {
+      return v13::flow_entry{
+          make_oxm_match(num_fields)
+        , protocol::OFP_DEFAULT_PRIORITY
+        , 0xf1f2f3f4f5f6f7f8
+        , v13::instruction_set{
+              instructions::apply_actions{make_action_list()}
+            , instructions::goto_table{1}
+          }
+      };
+    }
+
+    auto make_flow_add(std::size_t const num_fields)
+      -> msg::flow_add
+    {
+      return msg::flow_add{
+          make_flow_entry(num_fields), 0, v13::timeouts{0, 300}
+        , protocol::OFPFF_SEND_FLOW_REM, protocol::OFP_NO_BUFFER
+      };
+    }
+
+    // what most flow entries look like: a few match fields,
+    // one or two actions and at most a couple of instructions
+    auto make_typical_flow_entry(std::uint32_t const i)
+      -> v13::flow_entry
+    {
+      return v13::flow_entry{
+          make_oxm_match(5)
+        , std::uint16_t(i)
+        , std::uint64_t{i}
+        , v13::instruction_set{
+              instructions::apply_actions{
+                  actions::set_eth_dst{eth2}
+                , actions::output{i % 48 + 1}
+              }
+            , instructions::goto_table{1}
+          }
+      };
+    }
+
+    auto make_typical_flow_stats_reply(std::size_t const num_entries)
+      -> multipart::flow_stats_reply
+    {
+      auto body = multipart::flow_stats_reply::body_type{};
+      body.reserve(num_entries);
+      for (auto i = std::uint32_t{0}; i < num_entries; ++i) {
+        body.push_back(multipart::flow_stats{
+            make_typical_flow_entry(i)
+          , 0, 0, v13::timeouts{0, 0}, v13::elapsed_time{i, 0}
+          , v13::counters{i, i * 64}
+        });
+      }
+      return multipart::flow_stats_reply{std::move(body)};
+    }
+
+    auto make_port(std::uint32_t const port_no)
+      -> v13::port
+    {
+      auto const name = "eth" + std::to_string(port_no);
+      return v13::port{
+          port_no, eth1, name.c_str(), 0, protocol::OFPPS_LIVE
+        , protocol::OFPPF_10GB_FD | protocol::OFPPF_FIBER
+        , protocol::OFPPF_10GB_FD | protocol::OFPPF_FIBER
+        , protocol::OFPPF_10GB_FD | protocol::OFPPF_FIBER
+        , protocol::OFPPF_10GB_FD | protocol::OFPPF_FIBER
+        , 10000000, 10000000
+      };
+    }
+
+    auto make_flow_stats_reply(std::size_t const num_entries)
+      -> multipart::flow_stats_reply
+    {
+      // 64 bytes per entry keeps 1000 entries within a single message
+      auto body = multipart::flow_stats_reply::body_type{};
+      body.reserve(num_entries);
+      for (auto i = std::uint32_t{0}; i < num_entries; ++i) {
+        body.push_back(multipart::flow_stats{
+            v13::flow_entry{
+                v13::oxm_match{fields::in_port{i % 48 + 1}}
+              , std::uint16_t(i), std::uint64_t{i}, v13::instruction_set{}
+            }
+          , 0, 0, v13::timeouts{0, 0}, v13::elapsed_time{i, 0}
+          , v13::counters{i, i * 64}
+        });
+      }
+      return multipart::flow_stats_reply{std::move(body)};
+    }
+
+    auto make_oxm_ids()
+      -> v13::table_feature_properties::match
+    {
+      auto const basic = protocol::OFPXMC_OPENFLOW_BASIC;
+      return v13::table_feature_properties::match{
+          v13::oxm_id{basic, protocol::OFPXMT_OFB_IN_PORT, false, 4}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_METADATA, true, 16}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_ETH_DST, true, 12}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_ETH_SRC, true, 12}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_ETH_TYPE, false, 2}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_VLAN_VID, true, 4}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_IP_PROTO, false, 1}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_IPV4_SRC, true, 8}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_IPV4_DST, true, 8}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_TCP_SRC, false, 2}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_TCP_DST, false, 2}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_UDP_SRC, false, 2}
+        , v13::oxm_id{basic, protocol::OFPXMT_OFB_UDP_DST, false, 2}
+      };
+    }
+
+    auto make_table_features_reply(std::size_t const num_tables)
+      -> multipart::table_features_reply
+    {
+      namespace props = v13::table_feature_properties;
+      auto const properties = v13::table_feature_property_set{
+          props::instructions{
+              v13::instruction_id{protocol::OFPIT_GOTO_TABLE}
+            , v13::instruction_id{protocol::OFPIT_WRITE_METADATA}
+            , v13::instruction_id{protocol::OFPIT_WRITE_ACTIONS}
+            , v13::instruction_id{protocol::OFPIT_APPLY_ACTIONS}
+            , v13::instruction_id{protocol::OFPIT_CLEAR_ACTIONS}
+            , v13::instruction_id{protocol::OFPIT_METER}
+          }
+        , props::next_tables{1, 2, 3, 4, 5, 6, 7}
+        , props::apply_actions{
+              v13::action_id{protocol::OFPAT_OUTPUT}
+            , v13::action_id{protocol::OFPAT_PUSH_VLAN}
+            , v13::action_id{protocol::OFPAT_POP_VLAN}
+            , v13::action_id{protocol::OFPAT_SET_QUEUE}
+            , v13::action_id{protocol::OFPAT_GROUP}
+            , v13::action_id{protocol::OFPAT_SET_FIELD}
+          }
+        , make_oxm_ids()
+      };
+      auto body = multipart::table_features_reply::body_type{};
+      for (auto i = std::size_t{0}; i < num_tables; ++i) {
+        auto const name = "table" + std::to_string(i);
+        body.push_back(multipart::table_features{
+            std::uint8_t(i), name.c_str(), 0, 0, 0, 1000000, properties
+        });
+      }
+      return multipart::table_features_reply{std::move(body)};
+    }
+
+    auto make_port_stats_reply(std::size_t const num_ports)
+      -> multipart::port_stats_reply
+    {
+      auto body = multipart::port_stats_reply::body_type{};
+      for (auto i = std::uint32_t{0}; i < num_ports; ++i) {
+        body.push_back(multipart::port_stats{
+            i + 1, i, i, i, i, 0, 0, 0, 0, 0, 0, 0, 0, v13::elapsed_time{i, 0}
+        });
+      }
+      return multipart::port_stats_reply{std::move(body)};
+    }
+
+    auto make_port_description_reply(std::size_t const num_ports)
+      -> multipart::port_description_reply
+    {
+      auto body = multipart::port_description_reply::body_type{};
+      for (auto i = std::uint32_t{0}; i < num_ports; ++i) {
+        body.push_back(make_port(i + 1));
+      }
+      return multipart::port_description_reply{std::move(body)};
+    }
+
+    auto make_table_stats_reply(std::size_t const num_tables)
+      -> multipart::table_stats_reply
+    {
+      auto body = multipart::table_stats_reply::body_type{};
+      for (auto i = std::size_t{0}; i < num_tables; ++i) {
+        body.push_back(multipart::table_stats{std::uint8_t(i), 100, 1000, 900});
+      }
+      return multipart::table_stats_reply{std::move(body)};
+    }
+
+  } // namespace
+
+  void register_v13_messages()
+  {
+    auto const masks = msg::get_async_reply::mask_array_type{{0x3, 0x0}};
+
+    register_message("v13/hello", msg::hello{
+        v13::hello_elements::versionbitmap{{0x00000012}}
+    });
+    register_message("v13/error", msg::error{
+        protocol::bad_request_code::bad_type, msg::error::data_type(64, 0x1)
+    });
+    register_message(
+        "v13/echo_request", msg::echo_request{msg::echo_request::data_type(32)});
+    register_message(
+        "v13/echo_reply", msg::echo_reply{msg::echo_reply::data_type(32)});
+    register_message("v13/features_request", msg::features_request{});
+    register_message("v13/features_reply", msg::features_reply{
+        msg::features_request{}, 1, 256, 254, 0, protocol::OFPC_FLOW_STATS
+    });
+    register_message("v13/get_config_request", msg::get_config_request{});
+    register_message(
+        "v13/get_config_reply", msg::get_config_reply{0, 0xffff});
+    register_message("v13/set_config", msg::set_config{0, 0xffff});
+    register_message("v13/packet_in/1500", msg::packet_in{
+        protocol::OFP_NO_BUFFER, 1500, protocol::OFPR_NO_MATCH, 0, 0
+      , v13::oxm_match{fields::in_port{3}}, make_frame(1500)
+    });
+    register_message("v13/flow_removed", msg::flow_removed{
+        make_oxm_match(10), protocol::OFP_DEFAULT_PRIORITY, 0
+      , protocol::OFPRR_IDLE_TIMEOUT, 0, v13::elapsed_time{10, 0}
+      , v13::timeouts{10, 0}, v13::counters{100, 6400}
+    });
+    register_message(
+        "v13/port_status", msg::port_status{protocol::OFPPR_MODIFY, make_port(1)});
+    register_message("v13/packet_out/1500", msg::packet_out{
+        make_frame(1500), protocol::OFPP_CONTROLLER, make_action_list()
+    });
+    register_message("v13/flow_add/typical", msg::flow_add{
+        make_typical_flow_entry(1), 0, v13::timeouts{0, 300}
+      , protocol::OFPFF_SEND_FLOW_REM, protocol::OFP_NO_BUFFER
+    });
+    register_message("v13/flow_add/10", make_flow_add(10));
+    register_message("v13/flow_add/20", make_flow_add(20));
+    register_message("v13/flow_add/40", make_flow_add(40));
+    register_message("v13/flow_modify", msg::flow_modify{
+        make_oxm_match(10), 0
+      , v13::instruction_set{instructions::apply_actions{make_action_list()}}
+    });
+    register_message("v13/flow_delete", msg::flow_delete{
+        make_oxm_match(10), protocol::OFPTT_ALL, v13::cookie_mask{0, 0}
+    });
+    register_message("v13/group_add", msg::group_add{
+        1, protocol::OFPGT_SELECT
+      , msg::group_add::buckets_type{
+            v13::bucket{1, make_action_set()}
+          , v13::bucket{1, make_action_set()}
+          , v13::bucket{1, make_action_set()}
+          , v13::bucket{1, make_action_set()}
+        }
+    });
+    register_message("v13/port_mod", msg::port_mod{
+        1, eth1, protocol::OFPPC_NO_FWD, protocol::OFPPC_NO_FWD, 0
+    });
+    register_message("v13/table_mod", msg::table_mod{0, 0});
+    register_message_with_equivalence("v13/meter_add", msg::meter_add{
+        1, protocol::OFPMF_KBPS
+      , msg::meter_add::bands_type{
+            v13::meter_bands::drop{10000, 0}
+          , v13::meter_bands::dscp_remark{1, 20000, 0}
+        }
+    });
+    register_message("v13/barrier_request", msg::barrier_request{});
+    register_message("v13/barrier_reply", msg::barrier_reply{0});
+    register_message(
+        "v13/queue_get_config_request", msg::queue_get_config_request{1});
+    register_message(
+        "v13/role_request", msg::role_request{protocol::OFPCR_ROLE_MASTER, 1});
+    register_message(
+        "v13/role_reply", msg::role_reply{protocol::OFPCR_ROLE_MASTER, 1});
+    register_message("v13/get_async_request", msg::get_async_request{});
+    register_message(
+        "v13/get_async_reply", msg::get_async_reply{masks, masks, masks});
+    register_message("v13/set_async", msg::set_async{masks, masks, masks});
+
+    register_message(
+        "v13/description_request", multipart::description_request{});
+    register_message("v13/description_reply", multipart::description_reply{
+        "manufacturer", "hardware", "software", "serial", "datapath"
+    });
+    register_message(
+        "v13/flow_stats_request", multipart::flow_stats_request{
+            make_oxm_match(10), protocol::OFPTT_ALL
+    });
+    register_message(
+        "v13/flow_stats_reply/1000", make_flow_stats_reply(1000));
+    // 144 bytes per entry
+    register_message(
+        "v13/flow_stats_reply/typical/400", make_typical_flow_stats_reply(400));
+    register_message(
+        "v13/aggregate_stats_reply", multipart::aggregate_stats_reply{
+            v13::counters{1000, 64000}, 1000
+    });
+    register_message(
+        "v13/table_stats_reply/254", make_table_stats_reply(254));
+    register_message(
+        "v13/port_stats_request", multipart::port_stats_request{protocol::OFPP_ANY});
+    register_message("v13/port_stats_reply/48", make_port_stats_reply(48));
+    register_message(
+        "v13/port_description_reply/48", make_port_description_reply(48));
+    register_message(
+        "v13/table_features_request", multipart::table_features_request{});
+    register_message(
+        "v13/table_features_reply/64", make_table_features_reply(64));
+  }
+
+} // namespace bench
@@ -0,0 +1,85 @@
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <canard/net/ofp/memory_resource.hpp>
+
+#include "flow_stats_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace multipart = ofp::v13::messages::multipart;
+
+namespace {
+
+  void decode_with_iterator(benchmark::State& state)
+  {
+    auto const bin = bench::make_flow_stats_reply_binary(state.range(0));
+    for (auto _ : state) {
+      auto it = bin.begin();
+      auto reply = multipart::flow_stats_reply::decode(it, bin.end());
+      benchmark::DoNotOptimize(reply);
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(decode_with_iterator)->Arg(1)->Arg(100)->Arg(300);
+
+  void decode_into_monotonic_buffer(benchmark::State& state)
+  {
+    auto const bin = bench::make_flow_stats_reply_binary(state.range(0));
+    auto buffer = std::vector<unsigned char>(bin.size() * 16);
+    ofp::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+    for (auto _ : state) {
+      {
+        ofp::scoped_memory_resource const scope{arena};
+        unsigned char const* it = bin.data();
+        auto reply = multipart::flow_stats_reply::decode(
+            it, bin.data() + bin.size());
+        benchmark::DoNotOptimize(reply);
+      }
+      arena.release();
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(decode_into_monotonic_buffer)->Arg(1)->Arg(100)->Arg(300);
+
+  void iterate_view(benchmark::State& state)
+  {
+    auto const bin = bench::make_flow_stats_reply_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, bin.data() + bin.size());
+      auto packet_count = std::uint64_t{0};
+      for (auto const& flow_stats : view) {
+        packet_count += flow_stats.packet_count();
+      }
+      benchmark::DoNotOptimize(packet_count);
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(iterate_view)->Arg(1)->Arg(100)->Arg(300);
+
+  void decode_each_element_of_view(benchmark::State& state)
+  {
+    auto const bin = bench::make_flow_stats_reply_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, bin.data() + bin.size());
+      for (auto const& flow_stats : view) {
+        auto const element = multipart::flow_stats{flow_stats};
+        benchmark::DoNotOptimize(element);
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(decode_each_element_of_view)->Arg(1)->Arg(100)->Arg(300);
+
+} // namespace
+
+BENCHMARK_MAIN();
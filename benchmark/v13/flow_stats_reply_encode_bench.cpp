@@ -0,0 +1,53 @@
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+#include <canard/net/ofp/raw_buffer.hpp>
+#include "flow_stats_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+
+namespace {
+
+  void encode_to_vector(benchmark::State& state)
+  {
+    auto const reply = bench::make_flow_stats_reply(state.range(0));
+    for (auto _ : state) {
+      auto buffer = std::vector<unsigned char>{};
+      reply.encode(buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * reply.byte_length());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(encode_to_vector)->Arg(1)->Arg(100)->Arg(300);
+
+  void encode_exact_to_vector(benchmark::State& state)
+  {
+    auto const reply = bench::make_flow_stats_reply(state.range(0));
+    for (auto _ : state) {
+      auto buffer = std::vector<unsigned char>{};
+      ofp::encode_exact(reply, buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * reply.byte_length());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(encode_exact_to_vector)->Arg(1)->Arg(100)->Arg(300);
+
+  void encode_to_raw_buffer(benchmark::State& state)
+  {
+    auto const reply = bench::make_flow_stats_reply(state.range(0));
+    auto buffer = std::vector<unsigned char>(reply.byte_length());
+    for (auto _ : state) {
+      auto const last = ofp::encode_to(reply, buffer.data(), buffer.size());
+      benchmark::DoNotOptimize(last);
+    }
+    state.SetBytesProcessed(state.iterations() * reply.byte_length());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(encode_to_raw_buffer)->Arg(1)->Arg(100)->Arg(300);
+
+} // namespace
+
+BENCHMARK_MAIN();
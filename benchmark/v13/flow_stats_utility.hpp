@@ -0,0 +1,70 @@
+#ifndef CANARD_NET_OFP_BENCHMARK_V13_FLOW_STATS_UTILITY_HPP
+#define CANARD_NET_OFP_BENCHMARK_V13_FLOW_STATS_UTILITY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <canard/mac_address.hpp>
+#include <canard/net/ofp/v13/actions.hpp>
+#include <canard/net/ofp/v13/instructions.hpp>
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+#include <canard/net/ofp/v13/utility/instruction_set.hpp>
+
+namespace bench {
+
+  namespace v13 = canard::net::ofp::v13;
+  namespace match = v13::oxm_match_fields;
+  namespace multipart = v13::messages::multipart;
+
+  inline auto make_flow_stats(std::uint32_t const i)
+    -> multipart::flow_stats
+  {
+    auto const eth1 = canard::mac_address{{{0x01, 0x02, 0x03, 0x04, 0x05, 0x06}}};
+    auto const eth2 = canard::mac_address{{{0x11, 0x12, 0x13, 0x14, 0x15, 0x16}}};
+    auto const entry = v13::flow_entry{
+        v13::oxm_match{
+            match::in_port{i % 48 + 1}
+          , match::eth_dst{eth1}
+          , match::eth_src{eth2}
+          , match::eth_type{0x0800}
+          , match::ip_proto{6}
+          , match::tcp_dst{std::uint16_t(i)}
+        }
+      , std::uint16_t(i)
+      , std::uint64_t{i}
+      , v13::instruction_set{
+            v13::instructions::apply_actions{
+                v13::actions::set_eth_dst{eth2}
+              , v13::actions::output{i % 48 + 1}
+            }
+          , v13::instructions::goto_table{1}
+        }
+    };
+    return multipart::flow_stats{
+        entry, 0, 0
+      , v13::timeouts{0, 0}, v13::elapsed_time{i, 0}, v13::counters{i, i}
+    };
+  }
+
+  inline auto make_flow_stats_reply(std::size_t const n)
+    -> multipart::flow_stats_reply
+  {
+    auto body = multipart::flow_stats_reply::body_type{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      body.push_back(make_flow_stats(i));
+    }
+    return multipart::flow_stats_reply{std::move(body)};
+  }
+
+  inline auto make_flow_stats_reply_binary(std::size_t const n)
+    -> std::vector<unsigned char>
+  {
+    auto const reply = make_flow_stats_reply(n);
+    auto buffer = std::vector<unsigned char>{};
+    return reply.encode(buffer);
+  }
+
+} // namespace bench
+
+#endif // CANARD_NET_OFP_BENCHMARK_V13_FLOW_STATS_UTILITY_HPP
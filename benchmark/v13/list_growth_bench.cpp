@@ -0,0 +1,77 @@
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+#include <canard/net/ofp/v13/message/flow_add.hpp>
+
+#include "flow_stats_utility.hpp"
+
+namespace v13 = canard::net::ofp::v13;
+namespace multipart = v13::messages::multipart;
+
+namespace {
+
+  auto make_flow_stats_list(std::size_t const n)
+    -> std::vector<multipart::flow_stats>
+  {
+    auto list = std::vector<multipart::flow_stats>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      list.push_back(bench::make_flow_stats(i));
+    }
+    return list;
+  }
+
+  // Containers are filled without reserve, so that every reallocation
+  // moves the elements already inserted. The reserved cases show the cost
+  // of the insertions alone.
+  template <class Container, class Source>
+  void fill(benchmark::State& state, Source const& source, bool const reserve)
+  {
+    for (auto _ : state) {
+      auto container = Container{};
+      if (reserve) {
+        container.reserve(source.size());
+      }
+      for (auto const& e : source) {
+        container.push_back(e);
+      }
+      benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * source.size());
+  }
+
+  void grow_flow_stats_list(benchmark::State& state)
+  {
+    auto const source = make_flow_stats_list(state.range(0));
+    fill<multipart::flow_stats_reply::body_type>(state, source, false);
+  }
+  BENCHMARK(grow_flow_stats_list)->Arg(16)->Arg(256)->Arg(1024);
+
+  void reserved_flow_stats_list(benchmark::State& state)
+  {
+    auto const source = make_flow_stats_list(state.range(0));
+    fill<multipart::flow_stats_reply::body_type>(state, source, true);
+  }
+  BENCHMARK(reserved_flow_stats_list)->Arg(16)->Arg(256)->Arg(1024);
+
+  void grow_flow_stats_vector(benchmark::State& state)
+  {
+    auto const source = make_flow_stats_list(state.range(0));
+    fill<std::vector<multipart::flow_stats>>(state, source, false);
+  }
+  BENCHMARK(grow_flow_stats_vector)->Arg(16)->Arg(256)->Arg(1024);
+
+  void grow_flow_add_vector(benchmark::State& state)
+  {
+    auto source = std::vector<v13::messages::flow_add>{};
+    for (auto const& stats : make_flow_stats_list(state.range(0))) {
+      source.emplace_back(stats.entry(), 0, v13::timeouts{0, 300}, 0, 0);
+    }
+    fill<std::vector<v13::messages::flow_add>>(state, source, false);
+  }
+  BENCHMARK(grow_flow_add_vector)->Arg(16)->Arg(256)->Arg(1024);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,52 @@
+#include <canard/net/ofp/v13/decoder/message_decoder.hpp>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace v13 = canard::net::ofp::v13;
+
+namespace {
+
+  struct discard
+  {
+    template <class T>
+    void operator()(T&&) const {}
+  };
+
+  // barrier_reply with an unsupported message type; the error is found by
+  // the type dispatch, so try_decode reports it without throwing
+  auto const unknown_type_bin = std::vector<unsigned char>{
+    0x04, 0xff, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01
+  };
+
+  void decode_with_exception(benchmark::State& state)
+  {
+    for (auto _ : state) {
+      auto it = unknown_type_bin.begin();
+      try {
+        v13::message_decoder::decode<void>(
+            it, unknown_type_bin.end(), discard{});
+      }
+      catch (v13::exception const& e) {
+        benchmark::DoNotOptimize(e.error_code());
+      }
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(decode_with_exception);
+
+  void try_decode_with_result(benchmark::State& state)
+  {
+    for (auto _ : state) {
+      auto it = unknown_type_bin.begin();
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, unknown_type_bin.end(), discard{});
+      benchmark::DoNotOptimize(result.error().error_code());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(try_decode_with_result);
+
+} // namespace
+
+BENCHMARK_MAIN();
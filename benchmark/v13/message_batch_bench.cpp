@@ -0,0 +1,80 @@
+#include <canard/net/ofp/message_batch.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+#include <canard/net/ofp/v13/message/flow_add.hpp>
+
+#include "flow_stats_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+
+namespace {
+
+  auto make_flow_adds(std::size_t const n)
+    -> std::vector<v13::messages::flow_add>
+  {
+    auto flow_adds = std::vector<v13::messages::flow_add>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      flow_adds.emplace_back(
+          bench::make_flow_stats(i).entry(), 0, v13::timeouts{0, 300}, 0, 0);
+    }
+    return flow_adds;
+  }
+
+  // Each message is encoded into its own vector, which is then appended to
+  // the send buffer.
+  void send_buffer_of_encoded_messages(benchmark::State& state)
+  {
+    auto const flow_adds = make_flow_adds(state.range(0));
+    auto send_buffer = std::vector<unsigned char>{};
+    for (auto _ : state) {
+      send_buffer.clear();
+      for (auto const& flow_add : flow_adds) {
+        auto buffer = std::vector<unsigned char>{};
+        flow_add.encode(buffer);
+        send_buffer.insert(send_buffer.end(), buffer.begin(), buffer.end());
+      }
+      benchmark::DoNotOptimize(send_buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * flow_adds.size());
+  }
+  BENCHMARK(send_buffer_of_encoded_messages)->Arg(1000);
+
+  void message_batch(benchmark::State& state)
+  {
+    auto const flow_adds = make_flow_adds(state.range(0));
+    auto batch = ofp::message_batch{v13::protocol::OFP_VERSION};
+    batch.assign_xids_from(0);
+    for (auto _ : state) {
+      batch.clear();
+      for (auto const& flow_add : flow_adds) {
+        batch.push_back(flow_add);
+      }
+      benchmark::DoNotOptimize(batch.chunk(0).data());
+    }
+    state.SetItemsProcessed(state.iterations() * flow_adds.size());
+  }
+  BENCHMARK(message_batch)->Arg(1000);
+
+  void chunked_message_batch(benchmark::State& state)
+  {
+    auto const flow_adds = make_flow_adds(state.range(0));
+    auto batch = ofp::message_batch{v13::protocol::OFP_VERSION, 64 * 1024};
+    batch.assign_xids_from(0);
+    batch.insert_barrier_every(100);
+    for (auto _ : state) {
+      batch.clear();
+      for (auto const& flow_add : flow_adds) {
+        batch.push_back(flow_add);
+      }
+      benchmark::DoNotOptimize(batch.chunk(0).data());
+    }
+    state.SetItemsProcessed(state.iterations() * flow_adds.size());
+  }
+  BENCHMARK(chunked_message_batch)->Arg(1000);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,85 @@
+#include <canard/net/ofp/v13/utility/multipart_reassembler.hpp>
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+
+#include "flow_stats_utility.hpp"
+
+namespace v13 = canard::net::ofp::v13;
+namespace multipart = v13::messages::multipart;
+namespace protocol = v13::protocol;
+
+namespace {
+
+  // a full table dump split into num_replies replies of num_flows flows
+  auto make_replies(std::size_t const num_replies, std::size_t const num_flows)
+    -> std::vector<multipart::flow_stats_reply>
+  {
+    auto replies = std::vector<multipart::flow_stats_reply>{};
+    for (auto i = std::size_t{0}; i < num_replies; ++i) {
+      auto body = multipart::flow_stats_reply::body_type{};
+      for (auto j = std::size_t{0}; j < num_flows; ++j) {
+        body.push_back(bench::make_flow_stats(i * num_flows + j));
+      }
+      auto const flags = i + 1 == num_replies ? 0 : protocol::OFPMPF_REPLY_MORE;
+      replies.emplace_back(std::move(body), flags, 1);
+    }
+    return replies;
+  }
+
+  // Each reply's elements are copied into the aggregate list.
+  void copy_reply_bodies(benchmark::State& state)
+  {
+    auto const replies = make_replies(state.range(0), state.range(1));
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto inputs = replies;
+      state.ResumeTiming();
+      auto body = multipart::flow_stats_reply::body_type{};
+      for (auto const& reply : inputs) {
+        body.insert(body.end(), reply.body().begin(), reply.body().end());
+      }
+      benchmark::DoNotOptimize(body.byte_length());
+      state.PauseTiming();
+      inputs.clear();
+      body.clear();
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(
+        state.iterations() * state.range(0) * state.range(1));
+  }
+  BENCHMARK(copy_reply_bodies)->Args({250, 400});
+
+  void reassemble_replies(benchmark::State& state)
+  {
+    auto const replies = make_replies(state.range(0), state.range(1));
+    using reassembler_type
+      = v13::multipart_reassembler<multipart::flow_stats_reply>;
+    auto reassembler = reassembler_type{std::chrono::seconds{10}};
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto inputs = replies;
+      state.ResumeTiming();
+      auto aggregate = boost::optional<reassembler_type::aggregate_type>{};
+      for (auto& reply : inputs) {
+        aggregate = reassembler.push(std::move(reply));
+      }
+      benchmark::DoNotOptimize(aggregate->body.byte_length());
+      state.PauseTiming();
+      inputs.clear();
+      aggregate = boost::none;
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(
+        state.iterations() * state.range(0) * state.range(1));
+  }
+  BENCHMARK(reassemble_replies)->Args({250, 400});
+
+} // namespace
+
+BENCHMARK_MAIN();
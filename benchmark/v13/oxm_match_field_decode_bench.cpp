@@ -0,0 +1,203 @@
+#include <canard/net/ofp/v13/decoder/oxm_match_field_decoder.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/address_v6.hpp>
+#include <boost/preprocessor/repeat.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace fields = v13::oxm_match_fields;
+using boost::asio::ip::address_v4;
+using boost::asio::ip::address_v6;
+
+namespace {
+
+  // The switch based decoder which the table based one replaced, kept here
+  // as the baseline.
+  struct switch_oxm_match_field_decoder
+  {
+    using decode_type_list = v13::default_oxm_match_field_list;
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode(Iterator& first, Iterator last, Function function)
+      -> ReturnType
+    {
+      using policy = ofp::detail::v13::throw_decode_error;
+
+      auto const oxm_header
+        = v13::oxm_header::decode_without_consumption(first, last);
+
+      if (std::distance(first, last)
+          < std::uint16_t(oxm_header.length() + oxm_header.oxm_length())) {
+        return policy::error<ReturnType>(v13::decode_error{
+            v13::protocol::bad_request_code::bad_len
+          , "too small data size for oxm_match_field"
+        });
+      }
+
+      switch (oxm_header.oxm_type()) {
+
+#     define CANARD_NET_OFP_V13_MATCH_FIELD_CASE(z, N, _) \
+      using field ## N = std::tuple_element<N, decode_type_list>::type; \
+      case field ## N::oxm_type(): \
+        if (!field ## N::is_valid_oxm_match_field_length(oxm_header)) { \
+          return policy::error<ReturnType>(v13::decode_error{ \
+              v13::protocol::bad_match_code::bad_len \
+            , "invalid oxm_match_field length" \
+          }); \
+        } \
+        return policy::decode<ReturnType, field ## N>(first, last, function);
+
+      BOOST_PP_REPEAT(40, CANARD_NET_OFP_V13_MATCH_FIELD_CASE, _)
+
+#     undef CANARD_NET_OFP_V13_MATCH_FIELD_CASE
+
+      default:
+        return policy::error<ReturnType>(v13::decode_error{
+          v13::protocol::bad_match_code::bad_field, "unknown oxm_match_field"
+        });
+      }
+    }
+  };
+
+  struct to_oxm_type
+  {
+    template <class T>
+    auto operator()(T const& t) const
+      -> std::uint32_t
+    {
+      benchmark::DoNotOptimize(t);
+      return T::oxm_type();
+    }
+  };
+
+  template <class T>
+  void append(std::vector<unsigned char>& buffer, T const& field)
+  {
+    field.encode(buffer);
+  }
+
+  using field_encoder = void(*)(std::vector<unsigned char>&, std::size_t);
+
+  // Fields of a typical L2-L4 flow match, with and without masks.
+  auto field_encoders()
+    -> std::vector<field_encoder>
+  {
+    return {
+        [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::in_port(i)); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::metadata(i << 8, 0xffffffffffffff00)); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        {
+          append(b, fields::eth_dst{
+              canard::mac_address{{{0, 1, 2, 3, 4, std::uint8_t(i)}}}});
+        }
+      , [](std::vector<unsigned char>& b, std::size_t)
+        { append(b, fields::eth_type{0x0800}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        {
+          append(b, fields::vlan_vid(
+                v13::protocol::OFPVID_PRESENT | std::uint16_t(i % 4096)));
+        }
+      , [](std::vector<unsigned char>& b, std::size_t)
+        { append(b, fields::ip_proto{6}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::ipv4_src{address_v4(i << 16), 16}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::ipv4_dst{address_v4(i)}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::ipv6_dst{address_v6::v4_mapped(address_v4(i))}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::tcp_src(i % 65536)); }
+      , [](std::vector<unsigned char>& b, std::size_t)
+        { append(b, fields::tcp_dst{80}); }
+      , [](std::vector<unsigned char>& b, std::size_t i)
+        { append(b, fields::udp_dst(i % 65536)); }
+    };
+  }
+
+  // Field types are drawn at random with a fixed seed, so that the type of
+  // the next field is not predictable from the previous ones.
+  auto make_mixed_corpus(std::size_t const n)
+    -> std::vector<unsigned char>
+  {
+    auto const encoders = field_encoders();
+    auto engine = std::mt19937{0};
+    auto dist = std::uniform_int_distribution<std::size_t>{
+      0, encoders.size() - 1
+    };
+    auto buffer = std::vector<unsigned char>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      encoders[dist(engine)](buffer, i);
+    }
+    return buffer;
+  }
+
+  auto make_ordered_corpus(std::size_t const n)
+    -> std::vector<unsigned char>
+  {
+    auto const encoders = field_encoders();
+    auto buffer = std::vector<unsigned char>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      encoders[i % encoders.size()](buffer, i);
+    }
+    return buffer;
+  }
+
+  template <class Decoder>
+  void decode_all(
+      benchmark::State& state, std::vector<unsigned char> const& corpus)
+  {
+    auto num_fields = std::size_t{0};
+    for (auto _ : state) {
+      auto it = corpus.begin();
+      num_fields = 0;
+      while (it != corpus.end()) {
+        benchmark::DoNotOptimize(
+            Decoder::template decode<std::uint32_t>(
+              it, corpus.end(), to_oxm_type{}));
+        ++num_fields;
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * num_fields);
+  }
+
+  void decode_mixed_fields_by_table(benchmark::State& state)
+  {
+    decode_all<v13::oxm_match_field_decoder>(
+        state, make_mixed_corpus(state.range(0)));
+  }
+  BENCHMARK(decode_mixed_fields_by_table)->Arg(1024);
+
+  void decode_mixed_fields_by_switch(benchmark::State& state)
+  {
+    decode_all<switch_oxm_match_field_decoder>(
+        state, make_mixed_corpus(state.range(0)));
+  }
+  BENCHMARK(decode_mixed_fields_by_switch)->Arg(1024);
+
+  void decode_ordered_fields_by_table(benchmark::State& state)
+  {
+    decode_all<v13::oxm_match_field_decoder>(
+        state, make_ordered_corpus(state.range(0)));
+  }
+  BENCHMARK(decode_ordered_fields_by_table)->Arg(1024);
+
+  void decode_ordered_fields_by_switch(benchmark::State& state)
+  {
+    decode_all<switch_oxm_match_field_decoder>(
+        state, make_ordered_corpus(state.range(0)));
+  }
+  BENCHMARK(decode_ordered_fields_by_switch)->Arg(1024);
+
+} // namespace
+
+BENCHMARK_MAIN();
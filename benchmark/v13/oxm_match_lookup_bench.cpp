@@ -0,0 +1,70 @@
+#include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <benchmark/benchmark.h>
+
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/range/algorithm/find_if.hpp>
+
+namespace v13 = canard::net::ofp::v13;
+namespace fields = v13::oxm_match_fields;
+using boost::asio::ip::address_v4;
+
+namespace {
+
+  auto make_oxm_match()
+    -> v13::oxm_match
+  {
+    return v13::oxm_match{
+        fields::in_port{1}
+      , fields::vlan_vid{v13::protocol::OFPVID_PRESENT | 1}
+      , fields::vlan_pcp{3}
+      , fields::eth_type{0x0800}
+      , fields::ip_proto{6}
+      , fields::ipv4_src{address_v4{0x0a000001}}
+      , fields::ipv4_dst{address_v4{0x0a000002}}
+      , fields::tcp_src{5555}
+      , fields::tcp_dst{80}
+    };
+  }
+
+  template <class OXMMatchField>
+  auto linear_find(v13::oxm_match const& match)
+    -> OXMMatchField const&
+  {
+    auto const it = boost::find_if(
+          match.oxm_fields()
+        , [](v13::oxm_match::oxm_fields_type::const_reference v)
+          { return v.type() == OXMMatchField::oxm_type(); });
+    return v13::any_cast<OXMMatchField>(*it);
+  }
+
+  void lookup_by_linear_scan(benchmark::State& state)
+  {
+    auto const match = make_oxm_match();
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(linear_find<fields::in_port>(match));
+      benchmark::DoNotOptimize(linear_find<fields::eth_type>(match));
+      benchmark::DoNotOptimize(linear_find<fields::ip_proto>(match));
+      benchmark::DoNotOptimize(linear_find<fields::ipv4_dst>(match));
+      benchmark::DoNotOptimize(linear_find<fields::tcp_dst>(match));
+    }
+    state.SetItemsProcessed(state.iterations() * 5);
+  }
+  BENCHMARK(lookup_by_linear_scan);
+
+  void lookup_by_index(benchmark::State& state)
+  {
+    auto const match = make_oxm_match();
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(match.get<fields::in_port>());
+      benchmark::DoNotOptimize(match.get<fields::eth_type>());
+      benchmark::DoNotOptimize(match.get<fields::ip_proto>());
+      benchmark::DoNotOptimize(match.get<fields::ipv4_dst>());
+      benchmark::DoNotOptimize(match.get<fields::tcp_dst>());
+    }
+    state.SetItemsProcessed(state.iterations() * 5);
+  }
+  BENCHMARK(lookup_by_index);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,55 @@
+#include <canard/net/ofp/v13/message/packet_in.hpp>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace v13 = canard::net::ofp::v13;
+namespace msg = v13::messages;
+
+namespace {
+
+  auto make_packet_in_binary(std::size_t const frame_size)
+    -> std::vector<unsigned char>
+  {
+    auto const pkt_in = msg::packet_in{
+        v13::protocol::OFP_NO_BUFFER, std::uint16_t(frame_size)
+      , v13::protocol::OFPR_NO_MATCH, 0, 0
+      , v13::oxm_match{v13::oxm_match_fields::in_port{3}}
+      , std::vector<unsigned char>(frame_size, 0xab)
+    };
+    auto buffer = std::vector<unsigned char>{};
+    return pkt_in.encode(buffer);
+  }
+
+  void decode_packet_in(benchmark::State& state)
+  {
+    auto const bin = make_packet_in_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto const pkt_in = msg::packet_in::decode(it, bin.data() + bin.size());
+      benchmark::DoNotOptimize(pkt_in.in_port());
+      benchmark::DoNotOptimize(pkt_in.frame().data());
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(decode_packet_in)->Arg(60)->Arg(1500);
+
+  void decode_packet_in_view(benchmark::State& state)
+  {
+    auto const bin = make_packet_in_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto const view
+        = msg::packet_in_view::decode(it, bin.data() + bin.size());
+      benchmark::DoNotOptimize(view.in_port());
+      benchmark::DoNotOptimize(view.frame().begin());
+    }
+    state.SetBytesProcessed(state.iterations() * bin.size());
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(decode_packet_in_view)->Arg(60)->Arg(1500);
+
+} // namespace
+
+BENCHMARK_MAIN();
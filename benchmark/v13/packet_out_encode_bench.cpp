@@ -0,0 +1,58 @@
+#include <canard/net/ofp/v13/message/packet_out.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+#include <canard/net/ofp/gather_buffer.hpp>
+#include <canard/net/ofp/v13/actions.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+
+namespace {
+
+  auto make_packet_out(std::size_t const frame_length)
+    -> v13::messages::packet_out
+  {
+    return v13::messages::packet_out{
+        v13::messages::packet_out::data_type(frame_length, 0xa5)
+      , v13::protocol::OFPP_CONTROLLER
+      , v13::action_list{
+            v13::actions::push_vlan{0x8100}
+          , v13::actions::set_vlan_vid{v13::protocol::OFPVID_PRESENT | 3}
+          , v13::actions::output{3}
+        }
+      , 0x1234
+    };
+  }
+
+  void encode_packet_out_to_vector(benchmark::State& state)
+  {
+    auto const pkt_out = make_packet_out(state.range(0));
+    auto buffer = std::vector<unsigned char>{};
+    for (auto _ : state) {
+      buffer.clear();
+      pkt_out.encode(buffer);
+      benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pkt_out.byte_length());
+  }
+  BENCHMARK(encode_packet_out_to_vector)->Arg(64)->Arg(1500)->Arg(9000);
+
+  void encode_packet_out_to_gather_buffer(benchmark::State& state)
+  {
+    auto const pkt_out = make_packet_out(state.range(0));
+    auto buffer = ofp::gather_buffer{};
+    for (auto _ : state) {
+      buffer.clear();
+      pkt_out.encode(buffer);
+      auto const buffers = buffer.buffers();
+      benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetBytesProcessed(state.iterations() * pkt_out.byte_length());
+  }
+  BENCHMARK(encode_packet_out_to_gather_buffer)->Arg(64)->Arg(1500)->Arg(9000);
+
+} // namespace
+
+BENCHMARK_MAIN();
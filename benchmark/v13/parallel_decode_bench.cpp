@@ -0,0 +1,59 @@
+#include <canard/net/ofp/parallel_decode.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+
+#include "flow_stats_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace multipart = ofp::v13::messages::multipart;
+
+namespace {
+
+  using body_type = multipart::flow_stats_reply::body_type;
+
+  // the concatenated bodies of a reassembled full table dump
+  auto make_body_binary(std::size_t const num_flows)
+    -> std::vector<unsigned char>
+  {
+    auto buffer = std::vector<unsigned char>{};
+    for (auto i = std::size_t{0}; i < num_flows; ++i) {
+      bench::make_flow_stats(std::uint32_t(i)).encode(buffer);
+    }
+    return buffer;
+  }
+
+  void decode_sequentially(benchmark::State& state)
+  {
+    auto const bin = make_body_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto body = body_type::decode(it, bin.data() + bin.size());
+      benchmark::DoNotOptimize(body);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(decode_sequentially)
+    ->Arg(100000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+  void decode_in_parallel(benchmark::State& state)
+  {
+    auto const bin = make_body_binary(state.range(0));
+    for (auto _ : state) {
+      unsigned char const* it = bin.data();
+      auto body = ofp::parallel_decode<body_type>(
+          it, bin.data() + bin.size(), state.range(1));
+      benchmark::DoNotOptimize(body);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  BENCHMARK(decode_in_parallel)
+    ->Args({100000, 1})->Args({100000, 2})->Args({100000, 4})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
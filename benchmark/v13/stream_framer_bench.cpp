@@ -0,0 +1,111 @@
+#include <canard/net/ofp/stream_framer.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <canard/net/ofp/v13/decoder/message_decoder.hpp>
+#include <canard/net/ofp/v13/messages.hpp>
+#include "flow_stats_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace msg = v13::messages;
+
+namespace {
+
+  struct discard
+  {
+    template <class T>
+    void operator()(T&&) const {}
+  };
+
+  template <class Message>
+  void append(std::vector<unsigned char>& stream, Message const& message)
+  {
+    message.encode(stream);
+  }
+
+  auto make_stream()
+    -> std::vector<unsigned char>
+  {
+    auto stream = std::vector<unsigned char>{};
+    auto const reply = bench::make_flow_stats_reply(20);
+    for (auto i = 0; i < 200; ++i) {
+      append(stream, msg::echo_request{std::uint32_t(i)});
+      append(stream, msg::barrier_reply{std::uint32_t(i)});
+      append(stream, msg::packet_in{
+          v13::protocol::OFP_NO_BUFFER, 60, v13::protocol::OFPR_NO_MATCH, 0, 0
+        , v13::oxm_match{v13::oxm_match_fields::in_port{1}}
+        , std::vector<unsigned char>(60, 0xab)
+      });
+      if (i % 20 == 0) {
+        append(stream, reply);
+      }
+    }
+    return stream;
+  }
+
+  auto make_chunk_sizes(std::size_t const total, std::size_t const max_size)
+    -> std::vector<std::size_t>
+  {
+    auto engine = std::mt19937{1};
+    auto dist = std::uniform_int_distribution<std::size_t>{1, max_size};
+    auto sizes = std::vector<std::size_t>{};
+    for (auto sum = std::size_t{0}; sum < total; ) {
+      sizes.push_back(dist(engine));
+      sum += sizes.back();
+    }
+    return sizes;
+  }
+
+  template <class Handler>
+  void run(benchmark::State& state, Handler handler)
+  {
+    auto const stream = make_stream();
+    auto const chunk_sizes = make_chunk_sizes(stream.size(), state.range(0));
+    auto num_messages = std::size_t{0};
+    for (auto _ : state) {
+      auto framer = ofp::stream_framer{v13::protocol::OFP_VERSION};
+      auto first = stream.data();
+      auto const last = stream.data() + stream.size();
+      for (auto const chunk_size : chunk_sizes) {
+        auto size = std::min(chunk_size, std::size_t(last - first));
+        while (size != 0) {
+          auto const consumed = framer.feed(first, size);
+          first += consumed;
+          size -= consumed;
+          for (auto message = framer.next();
+              !message.empty(); message = framer.next()) {
+            handler(message);
+            ++num_messages;
+          }
+        }
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * stream.size());
+    state.SetItemsProcessed(num_messages);
+  }
+
+  void frame_only(benchmark::State& state)
+  {
+    run(state, [](ofp::stream_framer::message_range const& message) {
+      benchmark::DoNotOptimize(message.begin());
+    });
+  }
+  BENCHMARK(frame_only)->Arg(64)->Arg(1500)->Arg(16384);
+
+  void frame_and_decode(benchmark::State& state)
+  {
+    run(state, [](ofp::stream_framer::message_range const& message) {
+      auto it = message.begin();
+      v13::message_decoder::decode<void>(it, message.end(), discard{});
+    });
+  }
+  BENCHMARK(frame_and_decode)->Arg(64)->Arg(1500)->Arg(16384);
+
+} // namespace
+
+BENCHMARK_MAIN();
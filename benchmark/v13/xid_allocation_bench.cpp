@@ -0,0 +1,49 @@
+#include <canard/net/ofp/get_xid.hpp>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <canard/net/ofp/v13/utility/request_tracker.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+
+namespace {
+
+  // a single process-wide counter, as get_xid used to be
+  std::atomic<std::uint32_t> shared_xid{0};
+
+  void shared_counter(benchmark::State& state)
+  {
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          shared_xid.fetch_add(1, std::memory_order_relaxed));
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(shared_counter)->ThreadRange(1, 4)->UseRealTime();
+
+  void get_xid(benchmark::State& state)
+  {
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(ofp::get_xid());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(get_xid)->ThreadRange(1, 4)->UseRealTime();
+
+  // each thread stands for a connection owning its tracker
+  void request_tracker_next_xid(benchmark::State& state)
+  {
+    auto tracker = v13::request_tracker<>{std::chrono::seconds{5}};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(tracker.next_xid());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(request_tracker_next_xid)->ThreadRange(1, 4)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+#ifndef CANARD_NET_OFP_ALLOCATION_STATS_HPP
+#define CANARD_NET_OFP_ALLOCATION_STATS_HPP
+
+#include <cstddef>
+#include <atomic>
+#include <typeinfo>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  struct allocation_stats
+  {
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t allocated_bytes;
+    std::size_t live_bytes;
+    std::size_t peak_live_bytes;
+  };
+
+#if defined(CANARD_NET_OFP_ENABLE_ALLOCATION_STATS)
+  constexpr bool allocation_stats_enabled = true;
+#else
+  constexpr bool allocation_stats_enabled = false;
+#endif
+
+  namespace allocation_stats_detail {
+
+    class counter
+    {
+    public:
+      explicit counter(char const* const name) noexcept
+        : name_(name)
+        , next_(head().load(std::memory_order_relaxed))
+        , allocations_(0)
+        , deallocations_(0)
+        , allocated_bytes_(0)
+        , live_bytes_(0)
+        , peak_live_bytes_(0)
+      {
+        while (!head().compare_exchange_weak(
+              next_, this
+            , std::memory_order_release, std::memory_order_relaxed)) {
+        }
+      }
+
+      auto name() const noexcept
+        -> char const*
+      {
+        return name_;
+      }
+
+      auto next() const noexcept
+        -> counter const*
+      {
+        return next_;
+      }
+
+      void allocate(std::size_t const bytes) noexcept
+      {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        auto const live
+          = live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = peak_live_bytes_.load(std::memory_order_relaxed);
+        while (peak < live
+            && !peak_live_bytes_.compare_exchange_weak(
+              peak, live, std::memory_order_relaxed)) {
+        }
+      }
+
+      void deallocate(std::size_t const bytes) noexcept
+      {
+        deallocations_.fetch_add(1, std::memory_order_relaxed);
+        live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+      }
+
+      auto snapshot() const noexcept
+        -> allocation_stats
+      {
+        return allocation_stats{
+            allocations_.load(std::memory_order_relaxed)
+          , deallocations_.load(std::memory_order_relaxed)
+          , allocated_bytes_.load(std::memory_order_relaxed)
+          , live_bytes_.load(std::memory_order_relaxed)
+          , peak_live_bytes_.load(std::memory_order_relaxed)
+        };
+      }
+
+      // live bytes are kept so that outstanding deallocations balance
+      void reset() noexcept
+      {
+        allocations_.store(0, std::memory_order_relaxed);
+        deallocations_.store(0, std::memory_order_relaxed);
+        allocated_bytes_.store(0, std::memory_order_relaxed);
+        peak_live_bytes_.store(
+            live_bytes_.load(std::memory_order_relaxed)
+          , std::memory_order_relaxed);
+      }
+
+      static auto head() noexcept
+        -> std::atomic<counter*>&
+      {
+        static std::atomic<counter*> head{nullptr};
+        return head;
+      }
+
+    private:
+      char const* name_;
+      counter* next_;
+      std::atomic<std::size_t> allocations_;
+      std::atomic<std::size_t> deallocations_;
+      std::atomic<std::size_t> allocated_bytes_;
+      std::atomic<std::size_t> live_bytes_;
+      std::atomic<std::size_t> peak_live_bytes_;
+    };
+
+    template <class Tag>
+    auto counter_of() noexcept
+      -> counter&
+    {
+      static counter instance{typeid(Tag).name()};
+      return instance;
+    }
+
+  } // namespace allocation_stats_detail
+
+  template <class Tag>
+  auto get_allocation_stats() noexcept
+    -> allocation_stats
+  {
+    return allocation_stats_detail::counter_of<Tag>().snapshot();
+  }
+
+  template <class Tag>
+  void reset_allocation_stats() noexcept
+  {
+    allocation_stats_detail::counter_of<Tag>().reset();
+  }
+
+  // Function is called with (char const* type_name, allocation_stats)
+  // for each type which has ever been counted.
+  template <class Function>
+  void for_each_allocation_stats(Function function)
+  {
+    using allocation_stats_detail::counter;
+    counter const* it = counter::head().load(std::memory_order_acquire);
+    for (; it; it = it->next()) {
+      function(it->name(), it->snapshot());
+    }
+  }
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_ALLOCATION_STATS_HPP
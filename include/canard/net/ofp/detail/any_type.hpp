@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <memory>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 #include <boost/mpl/contains.hpp>
 #include <boost/mpl/deref.hpp>
@@ -26,6 +27,20 @@ namespace detail {
 
   template <class Derived> class empty_any_type_base {};
 
+  template <class TypeList>
+  struct alternative_size_reporter;
+
+  template <template <class...> class TypeList, class... Types>
+  struct alternative_size_reporter<TypeList<Types...>>
+  {
+    template <class Function>
+    static void apply(Function& function)
+    {
+      using expand = int[];
+      (void) expand{0, (function(typeid(Types).name(), sizeof(Types)), 0)...};
+    }
+  };
+
   template <class Decoder, template <class> class Base = empty_any_type_base>
   class any_type
     : public Base<any_type<Decoder, Base>>
@@ -57,6 +72,20 @@ namespace detail {
       return min_element_t<min_byte_length_t>::value;
     }
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return Decoder::byte_length_from_header(header);
+    }
+
+    // Function is called with (char const* type_name, std::size_t size)
+    // for each alternative type.
+    template <class Function>
+    static void for_each_alternative_size(Function function)
+    {
+      alternative_size_reporter<inner_type_list>::apply(function);
+    }
+
     template <class T, class = containable_if_t<T>>
     any_type(T&& t)
       : variant_(std::forward<T>(t))
@@ -117,6 +146,15 @@ namespace detail {
       return Decoder::template decode<any_type>(first, last, to_any{});
     }
 
+    template <class Iterator, class Policy>
+    static auto decode(Iterator& first, Iterator last, Policy)
+      -> typename Policy::template result_type<any_type>
+    {
+      auto function = to_any{};
+      return Decoder::template decode_impl<any_type, Policy>(
+          first, last, function);
+    }
+
     friend auto operator==(any_type const& lhs, any_type const& rhs) noexcept
       -> bool
     {
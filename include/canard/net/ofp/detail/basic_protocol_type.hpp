@@ -170,6 +170,20 @@ namespace detail {
       return t;
     }
 
+    // Policy is a decode policy of the protocol version. T takes it as
+    // T::decode_impl(first, last, policy) if its body can be malformed.
+    template <class Iterator, class Policy>
+    static auto decode(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<T>
+    {
+      auto t = decode_with(first, last, policy, 0);
+      if (!Policy::failed(t)) {
+        bpt_detail::optionally_decode_padding(
+            first, last, Policy::value_of(t));
+      }
+      return t;
+    }
+
     template <class Iterator>
     static auto decode_without_consumption(Iterator first, Iterator last)
       -> T
@@ -209,6 +223,20 @@ namespace detail {
       return static_cast<T const&>(*this);
     }
 
+    template <class Iterator, class Policy, class U = T>
+    static auto decode_with(Iterator& first, Iterator last, Policy policy, int)
+      -> decltype(U::decode_impl(first, last, policy))
+    {
+      return U::decode_impl(first, last, policy);
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_with(Iterator& first, Iterator last, Policy, long)
+      -> typename Policy::template result_type<T>
+    {
+      return T::decode_impl(first, last);
+    }
+
     auto is_equal(T const& rhs) const
         noexcept(noexcept(std::declval<T>().equal_impl(rhs)))
       -> bool
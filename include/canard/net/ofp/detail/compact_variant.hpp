@@ -0,0 +1,472 @@
+#ifndef CANARD_NET_OFP_DETAIL_COMPACT_VARIANT_HPP
+#define CANARD_NET_OFP_DETAIL_COMPACT_VARIANT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  class bad_get
+    : public std::exception
+  {
+  public:
+    auto what() const noexcept
+      -> char const* override
+    {
+      return "canard::net::ofp::bad_get: "
+             "failed value get using ofp::detail::get";
+    }
+  };
+
+  namespace detail {
+
+    namespace compact_variant_detail {
+
+      template <std::size_t... Ns>
+      struct max_of;
+
+      template <std::size_t N>
+      struct max_of<N> : std::integral_constant<std::size_t, N> {};
+
+      template <std::size_t N, std::size_t M, std::size_t... Ns>
+      struct max_of<N, M, Ns...>
+        : max_of<(N < M ? M : N), Ns...>
+      {};
+
+      constexpr std::size_t npos = std::size_t(-1);
+
+      template <class T, class... Types>
+      struct index_of;
+
+      template <class T>
+      struct index_of<T>
+        : std::integral_constant<std::size_t, npos>
+      {};
+
+      template <class T, class... Types>
+      struct index_of<T, T, Types...>
+        : std::integral_constant<std::size_t, 0>
+      {};
+
+      template <class T, class U, class... Types>
+      struct index_of<T, U, Types...>
+        : std::integral_constant<
+              std::size_t
+            , index_of<T, Types...>::value == npos
+              ? npos : 1 + index_of<T, Types...>::value
+          >
+      {};
+
+      template <bool... Bs>
+      struct all_of;
+
+      template <>
+      struct all_of<> : std::true_type {};
+
+      template <bool B, bool... Bs>
+      struct all_of<B, Bs...>
+        : std::integral_constant<bool, B && all_of<Bs...>::value>
+      {};
+
+      template <std::size_t N>
+      using index_type_t = typename std::conditional<
+          (N <= 0xff), std::uint8_t, std::uint16_t
+      >::type;
+
+      // The value of T is moved into storage from a temporary after the
+      // previous value has been destroyed. The move is not allowed to fail,
+      // since there is no value to fall back to without heap backup.
+      template <class T>
+      void move_into(void* const storage, T& value) noexcept
+      {
+        ::new(storage) T(std::move(value));
+      }
+
+      // The index is looked up by binary search, so that a visitation takes
+      // at most log2(N) branches and the visitor is inlined at each leaf.
+      template <std::size_t First, std::size_t Last>
+      struct dispatcher
+      {
+        static constexpr std::size_t middle = First + (Last - First) / 2;
+
+        template <class Result, class Types, class Visitor, class Storage>
+        static auto apply(
+            std::size_t const index, Visitor& visitor, Storage* const storage)
+          -> Result
+        {
+          if (index < middle) {
+            return dispatcher<First, middle>::template apply<Result, Types>(
+                index, visitor, storage);
+          }
+          return dispatcher<middle, Last>::template apply<Result, Types>(
+              index, visitor, storage);
+        }
+      };
+
+      template <std::size_t I>
+      struct dispatcher<I, I + 1>
+      {
+        template <class Result, class Types, class Visitor, class Storage>
+        static auto apply(std::size_t, Visitor& visitor, Storage* const storage)
+          -> Result
+        {
+          using alternative = typename std::tuple_element<I, Types>::type;
+          using value_type = typename std::conditional<
+            std::is_const<Storage>::value, alternative const, alternative
+          >::type;
+          return visitor(*static_cast<value_type*>(storage));
+        }
+      };
+
+    } // namespace compact_variant_detail
+
+    // A never-empty discriminated union over Types.
+    // The active alternative is held in inline storage next to the smallest
+    // index type which can tell the alternatives apart. Assignment never
+    // falls back to heap backup storage.
+    template <class... Types>
+    class compact_variant
+    {
+      static_assert(sizeof...(Types) > 0, "no alternative type");
+
+      using index_type
+        = compact_variant_detail::index_type_t<sizeof...(Types)>;
+
+      template <class T>
+      using index_of = compact_variant_detail::index_of<T, Types...>;
+
+      template <class T, class U = typename std::decay<T>::type>
+      using alternative_if_t = typename std::enable_if<
+        index_of<U>::value != compact_variant_detail::npos
+      >::type;
+
+    public:
+      static constexpr std::size_t size = sizeof...(Types);
+
+      template <class T, class = alternative_if_t<T>>
+      compact_variant(T&& t)
+          noexcept(std::is_nothrow_constructible<
+            typename std::decay<T>::type, T&&
+          >::value)
+        : index_(index_of<typename std::decay<T>::type>::value)
+      {
+        using value_type = typename std::decay<T>::type;
+        ::new(address()) value_type(std::forward<T>(t));
+      }
+
+      compact_variant(compact_variant const& other)
+        : index_(other.index_)
+      {
+        if (other.holds_trivially_copyable()) {
+          std::memcpy(address(), other.address(), sizeof(storage_));
+          return;
+        }
+        other.visit_impl(copy_construct{address()});
+      }
+
+      compact_variant(compact_variant&& other)
+          noexcept(compact_variant_detail::all_of<
+            std::is_nothrow_move_constructible<Types>::value...
+          >::value)
+        : index_(other.index_)
+      {
+        if (other.holds_trivially_copyable()) {
+          std::memcpy(address(), other.address(), sizeof(storage_));
+          return;
+        }
+        other.visit_impl(move_construct{address()});
+      }
+
+      ~compact_variant()
+      {
+        destroy();
+      }
+
+      auto operator=(compact_variant const& other)
+        -> compact_variant&
+      {
+        if (this != std::addressof(other)) {
+          other.visit_impl(copy_assign{this});
+        }
+        return *this;
+      }
+
+      auto operator=(compact_variant&& other)
+          noexcept(compact_variant_detail::all_of<
+              std::is_nothrow_move_constructible<Types>::value...
+            , std::is_nothrow_move_assignable<Types>::value...
+          >::value)
+        -> compact_variant&
+      {
+        if (this != std::addressof(other)) {
+          other.visit_impl(move_assign{this});
+        }
+        return *this;
+      }
+
+      template <class T, class = alternative_if_t<T>>
+      auto operator=(T&& t)
+        -> compact_variant&
+      {
+        assign(std::forward<T>(t));
+        return *this;
+      }
+
+      auto which() const noexcept
+        -> int
+      {
+        return index_;
+      }
+
+      auto index() const noexcept
+        -> std::size_t
+      {
+        return index_;
+      }
+
+      template <class T>
+      auto is() const noexcept
+        -> bool
+      {
+        return index_ == index_of<T>::value;
+      }
+
+      template <class T>
+      auto unsafe_get() noexcept
+        -> T&
+      {
+        return *static_cast<T*>(address());
+      }
+
+      template <class T>
+      auto unsafe_get() const noexcept
+        -> T const&
+      {
+        return *static_cast<T const*>(address());
+      }
+
+      template <class Visitor>
+      auto visit_impl(Visitor&& visitor)
+        -> typename std::remove_reference<Visitor>::type::result_type
+      {
+        using result_type
+          = typename std::remove_reference<Visitor>::type::result_type;
+        return compact_variant_detail::dispatcher<0, sizeof...(Types)>
+          ::template apply<result_type, std::tuple<Types...>>(
+              index_, visitor, address());
+      }
+
+      template <class Visitor>
+      auto visit_impl(Visitor&& visitor) const
+        -> typename std::remove_reference<Visitor>::type::result_type
+      {
+        using result_type
+          = typename std::remove_reference<Visitor>::type::result_type;
+        return compact_variant_detail::dispatcher<0, sizeof...(Types)>
+          ::template apply<result_type, std::tuple<Types...>>(
+              index_, visitor, address());
+      }
+
+      friend auto operator==(
+          compact_variant const& lhs, compact_variant const& rhs)
+        -> bool
+      {
+        return lhs.index_ == rhs.index_
+            && lhs.visit_impl(equal_to{rhs.address()});
+      }
+
+      friend auto operator!=(
+          compact_variant const& lhs, compact_variant const& rhs)
+        -> bool
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+      auto address() noexcept
+        -> void*
+      {
+        return std::addressof(storage_);
+      }
+
+      auto address() const noexcept
+        -> void const*
+      {
+        return std::addressof(storage_);
+      }
+
+      // alternatives without any resource are copied and destroyed without
+      // visiting them
+      auto holds_trivially_copyable() const noexcept
+        -> bool
+      {
+        static constexpr bool table[] = {
+          std::is_trivially_copyable<Types>::value...
+        };
+        return table[index_];
+      }
+
+      auto holds_trivially_destructible() const noexcept
+        -> bool
+      {
+        static constexpr bool table[] = {
+          std::is_trivially_destructible<Types>::value...
+        };
+        return table[index_];
+      }
+
+      void destroy() noexcept
+      {
+        if (!holds_trivially_destructible()) {
+          visit_impl(destructor{});
+        }
+      }
+
+      template <class T>
+      void assign(T&& t)
+      {
+        using value_type = typename std::decay<T>::type;
+        if (index_ == index_of<value_type>::value) {
+          unsafe_get<value_type>() = std::forward<T>(t);
+          return;
+        }
+        emplace<value_type>(std::forward<T>(t));
+      }
+
+      template <class T, class Arg>
+      void emplace(Arg&& arg)
+      {
+        emplace_impl<T>(
+              std::forward<Arg>(arg)
+            , std::integral_constant<
+                  bool, std::is_nothrow_constructible<T, Arg&&>::value
+              >{});
+      }
+
+      template <class T, class Arg>
+      void emplace_impl(Arg&& arg, std::true_type)
+      {
+        destroy();
+        ::new(address()) T(std::forward<Arg>(arg));
+        index_ = index_of<T>::value;
+      }
+
+      // the new value is built aside first, so that a throwing constructor
+      // leaves the current value untouched
+      template <class T, class Arg>
+      void emplace_impl(Arg&& arg, std::false_type)
+      {
+        auto tmp = T(std::forward<Arg>(arg));
+        destroy();
+        compact_variant_detail::move_into(address(), tmp);
+        index_ = index_of<T>::value;
+      }
+
+      struct destructor
+      {
+        using result_type = void;
+
+        template <class T>
+        void operator()(T& t) const noexcept
+        {
+          t.~T();
+        }
+      };
+
+      struct copy_construct
+      {
+        using result_type = void;
+
+        template <class T>
+        void operator()(T const& t) const
+        {
+          ::new(storage) T(t);
+        }
+
+        void* storage;
+      };
+
+      struct move_construct
+      {
+        using result_type = void;
+
+        template <class T>
+        void operator()(T& t) const
+        {
+          ::new(storage) T(std::move(t));
+        }
+
+        void* storage;
+      };
+
+      struct copy_assign
+      {
+        using result_type = void;
+
+        template <class T>
+        void operator()(T const& t) const
+        {
+          self->assign(t);
+        }
+
+        compact_variant* self;
+      };
+
+      struct move_assign
+      {
+        using result_type = void;
+
+        template <class T>
+        void operator()(T& t) const
+        {
+          self->assign(std::move(t));
+        }
+
+        compact_variant* self;
+      };
+
+      struct equal_to
+      {
+        using result_type = bool;
+
+        template <class T>
+        auto operator()(T const& t) const
+          -> bool
+        {
+          return t == *static_cast<T const*>(rhs);
+        }
+
+        void const* rhs;
+      };
+
+    private:
+      // The storage is a plain byte array, so the index cannot reuse the
+      // tail padding of any alternative; it only takes the padding that
+      // rounds the variant up to its alignment, which is free when the
+      // largest alternative is not a multiple of that alignment.
+      alignas(compact_variant_detail::max_of<alignof(Types)...>::value)
+      unsigned char storage_[
+        compact_variant_detail::max_of<sizeof(Types)...>::value
+      ];
+      index_type index_;
+    };
+
+    template <class... Types>
+    constexpr std::size_t compact_variant<Types...>::size;
+
+  } // namespace detail
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_DETAIL_COMPACT_VARIANT_HPP
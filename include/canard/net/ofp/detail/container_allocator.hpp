@@ -0,0 +1,121 @@
+#ifndef CANARD_NET_OFP_DETAIL_CONTAINER_ALLOCATOR_HPP
+#define CANARD_NET_OFP_DETAIL_CONTAINER_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <canard/net/ofp/allocation_stats.hpp>
+#include <canard/net/ofp/memory_resource.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace detail {
+
+  // The default allocator of ofp::list.
+  // It is bound to the current_memory_resource() at construction, so that
+  // every nested container decoded under a scoped_memory_resource shares
+  // the same resource. As with std::pmr, the resource never propagates on
+  // assignment or swap: a container keeps the resource it was constructed
+  // with, and elements are moved one by one when the resources differ.
+  // Copies are bound to the resource current at the time of copying, and
+  // only move construction carries the resource of the source.
+  template <class T, class Tag = T>
+  class container_allocator
+  {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template <class U>
+    struct rebind
+    {
+      using other = container_allocator<U, Tag>;
+    };
+
+    container_allocator() noexcept
+      : resource_(ofp::current_memory_resource())
+    {
+    }
+
+    explicit container_allocator(memory_resource* const resource) noexcept
+      : resource_(resource)
+    {
+    }
+
+    template <class U>
+    container_allocator(container_allocator<U, Tag> const& other) noexcept
+      : resource_(other.resource())
+    {
+    }
+
+    auto resource() const noexcept
+      -> memory_resource*
+    {
+      return resource_;
+    }
+
+    auto allocate(std::size_t const n)
+      -> T*
+    {
+      auto const bytes = n * sizeof(T);
+      auto const ptr = resource_
+        ? resource_->allocate(bytes, alignof(T))
+        : ::operator new(bytes);
+#if defined(CANARD_NET_OFP_ENABLE_ALLOCATION_STATS)
+      allocation_stats_detail::counter_of<Tag>().allocate(bytes);
+#endif
+      return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* const ptr, std::size_t const n) noexcept
+    {
+      auto const bytes = n * sizeof(T);
+#if defined(CANARD_NET_OFP_ENABLE_ALLOCATION_STATS)
+      allocation_stats_detail::counter_of<Tag>().deallocate(bytes);
+#endif
+      if (resource_) {
+        resource_->deallocate(ptr, bytes, alignof(T));
+      }
+      else {
+        ::operator delete(ptr);
+      }
+    }
+
+    auto select_on_container_copy_construction() const noexcept
+      -> container_allocator
+    {
+      return container_allocator{};
+    }
+
+    template <class U>
+    friend auto operator==(
+          container_allocator const& lhs
+        , container_allocator<U, Tag> const& rhs) noexcept
+      -> bool
+    {
+      return lhs.resource() == rhs.resource();
+    }
+
+    template <class U>
+    friend auto operator!=(
+          container_allocator const& lhs
+        , container_allocator<U, Tag> const& rhs) noexcept
+      -> bool
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    memory_resource* resource_;
+  };
+
+} // namespace detail
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_DETAIL_CONTAINER_ALLOCATOR_HPP
@@ -15,12 +15,50 @@ namespace net {
 namespace ofp {
 namespace detail {
 
+  namespace encode_detail {
+
+    // Fallbacks for containers. Buffers of other kinds provide
+    // append_bytes and append_payload found by argument dependent lookup.
+    template <class Buffer>
+    void append_bytes(
+          Buffer& buffer
+        , unsigned char const* const first, std::size_t const size)
+    {
+      boost::push_back(buffer, boost::make_iterator_range_n(first, size));
+    }
+
+    template <class Buffer>
+    void append_payload(
+          Buffer& buffer
+        , unsigned char const* const first, std::size_t const size)
+    {
+      using encode_detail::append_bytes;
+      append_bytes(buffer, first, size);
+    }
+
+  } // namespace encode_detail
+
   template <class Buffer>
   auto encode_byte_array(
       Buffer& buffer, unsigned char const* const first, std::size_t const size)
     -> Buffer&
   {
-    return boost::push_back(buffer, boost::make_iterator_range_n(first, size));
+    using encode_detail::append_bytes;
+    append_bytes(buffer, first, size);
+    return buffer;
+  }
+
+  // Encodes bytes owned by the object being encoded, such as a frame or an
+  // echoed request. Buffers which can hold a reference to them may do so
+  // instead of copying.
+  template <class Buffer>
+  auto encode_payload(
+      Buffer& buffer, unsigned char const* const first, std::size_t const size)
+    -> Buffer&
+  {
+    using encode_detail::append_payload;
+    append_payload(buffer, first, size);
+    return buffer;
   }
 
   template <
@@ -4,9 +4,11 @@
 #include <canard/net/ofp/detail/config.hpp>
 #include <canard/net/ofp/list.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <utility>
@@ -18,279 +20,423 @@ namespace net {
 namespace ofp {
 
   // construct:
-  template <class ProtocolType>
-  list<ProtocolType>::list() = default;
+  template <class ProtocolType, class Allocator>
+  list<ProtocolType, Allocator>::list() = default;
 
-  template <class ProtocolType>
-  list<ProtocolType>::list(size_type const n, const_reference value)
+  template <class ProtocolType, class Allocator>
+  list<ProtocolType, Allocator>::list(allocator_type const& allocator)
+    : values_(typename container_type::allocator_type(allocator))
+  {
+  }
+
+  template <class ProtocolType, class Allocator>
+  list<ProtocolType, Allocator>::list(size_type const n, const_reference value)
     : values_(n, value)
+    , byte_length_(n * value.byte_length())
+  {
+  }
+
+  template <class ProtocolType, class Allocator>
+  list<ProtocolType, Allocator>::list(list&& other)
+    noexcept(list_detail::is_nothrow_move_constructible<
+        container_type
+    >::value)
+    : values_(std::move(other.values_))
+    , byte_length_(other.byte_length_)
   {
+    other.values_.clear();
+    other.byte_length_ = 0;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::operator=(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::operator=(list&& other)
+    noexcept(std::is_nothrow_move_assignable<container_type>::value)
+    -> list&
+  {
+    values_ = std::move(other.values_);
+    byte_length_ = other.byte_length_;
+    other.values_.clear();
+    other.byte_length_ = 0;
+    return *this;
+  }
+
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::operator=(
       std::initializer_list<value_type> const init_list)
     -> list&
   {
     values_ = init_list;
+    byte_length_ = length_impl();
     return *this;
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::assign(size_type const n, const_reference value)
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::assign(
+      size_type const n, const_reference value)
   {
+    auto const length = value.byte_length();
     values_.assign(n, value);
+    byte_length_ = n * length;
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::assign(
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::assign(
       std::initializer_list<value_type> const init_list)
   {
     values_.assign(init_list);
+    byte_length_ = length_impl();
+  }
+
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::get_allocator() const noexcept
+    -> allocator_type
+  {
+    return allocator_type(values_.get_allocator());
   }
 
   // iterators:
-  template <class ProtocolType>
-  auto list<ProtocolType>::begin() noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::begin() noexcept
     -> iterator
   {
+    invalidate_length();
     return values_.begin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::begin() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::begin() const noexcept
     -> const_iterator
   {
     return values_.begin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::end() noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::end() noexcept
     -> iterator
   {
+    invalidate_length();
     return values_.end();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::end() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::end() const noexcept
     -> const_iterator
   {
     return values_.end();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::cbegin() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::cbegin() const noexcept
     -> const_iterator
   {
     return values_.cbegin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::cend() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::cend() const noexcept
     -> const_iterator
   {
     return values_.cend();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::rbegin() noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::rbegin() noexcept
     -> reverse_iterator
   {
+    invalidate_length();
     return values_.rbegin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::rbegin() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::rbegin() const noexcept
     -> const_reverse_iterator
   {
     return values_.rbegin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::rend() noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::rend() noexcept
     -> reverse_iterator
   {
+    invalidate_length();
     return values_.rend();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::rend() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::rend() const noexcept
     -> const_reverse_iterator
   {
     return values_.rend();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::crbegin() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::crbegin() const noexcept
     -> const_reverse_iterator
   {
     return values_.crbegin();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::crend() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::crend() const noexcept
     -> const_reverse_iterator
   {
     return values_.crend();
   }
 
   // capacity:
-  template <class ProtocolType>
-  auto list<ProtocolType>::size() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::size() const noexcept
     -> size_type
   {
     return values_.size();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::max_size() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::max_size() const noexcept
     -> size_type
   {
     return values_.max_size();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::empty() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::empty() const noexcept
     -> bool
   {
     return values_.empty();
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::reserve(size_type const n)
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::capacity() const noexcept
+    -> size_type
+  {
+    return values_.capacity();
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::reserve(size_type const n)
   {
     values_.reserve(n);
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::shrink_to_fit()
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::shrink_to_fit()
   {
     values_.shrink_to_fit();
   }
 
   // element access:
-  template <class ProtocolType>
-  auto list<ProtocolType>::operator[](size_type const n)
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::operator[](size_type const n)
     -> reference
   {
+    invalidate_length();
     return values_[n];
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::operator[](size_type const n) const
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::operator[](size_type const n) const
     -> const_reference
   {
     return values_[n];
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::at(size_type const n)
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::at(size_type const n)
     -> reference
   {
+    invalidate_length();
     return values_.at(n);
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::at(size_type const n) const
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::at(size_type const n) const
     -> const_reference
   {
     return values_.at(n);
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::front()
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::front()
     -> reference
   {
+    invalidate_length();
     return values_.front();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::front() const
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::front() const
     -> const_reference
   {
     return values_.front();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::back()
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::back()
     -> reference
   {
+    invalidate_length();
     return values_.back();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::back() const
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::back() const
     -> const_reference
   {
     return values_.back();
   }
 
   // modifiers:
-  template <class ProtocolType>
-  void list<ProtocolType>::push_back(value_type const& value)
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::push_back(value_type const& value)
   {
     values_.push_back(value);
+    add_length(values_.back().byte_length());
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::push_back(value_type&& value)
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::push_back(value_type&& value)
   {
     values_.push_back(std::move(value));
+    add_length(values_.back().byte_length());
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::pop_back()
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::pop_back()
   {
+    auto const length = values_.back().byte_length();
     values_.pop_back();
+    subtract_length(length);
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::insert(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::insert(
       const_iterator const pos, size_type const n, const_reference value)
     -> iterator
   {
-    return values_.insert(pos, n, value);
+    auto const it = values_.insert(pos, n, value);
+    add_length(it, n);
+    return it;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::insert(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::insert(
         const_iterator const pos
       , std::initializer_list<value_type> const init_list)
     -> iterator
   {
-    return values_.insert(pos, init_list);
+    auto const it = values_.insert(pos, init_list);
+    add_length(it, init_list.size());
+    return it;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::erase(const_iterator const pos)
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::erase(const_iterator const pos)
     -> iterator
   {
-    return values_.erase(pos);
+    auto const length = pos->byte_length();
+    auto const it = values_.erase(pos);
+    subtract_length(length);
+    return it;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::erase(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::erase(
       const_iterator const first, const_iterator const last)
     -> iterator
   {
-    return values_.erase(first, last);
+    auto const length = std::accumulate(
+          first, last, std::size_t{0}
+        , [](std::size_t const sum, const_reference v)
+          { return sum + v.byte_length(); });
+    auto const it = values_.erase(first, last);
+    subtract_length(length);
+    return it;
+  }
+
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::replace(
+      const_iterator const pos, value_type const& value)
+    -> iterator
+  {
+    return replace(pos, value_type(value));
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::swap(list& other) noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::replace(
+      const_iterator const pos, value_type&& value)
+    -> iterator
   {
-    values_.swap(other.values_);
+    auto const length = pos->byte_length();
+    auto const it = std::next(values_.begin(), pos - values_.cbegin());
+    *it = std::move(value);
+    subtract_length(length);
+    add_length(it->byte_length());
+    return it;
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::clear() noexcept
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::splice(
+      const_iterator const pos, list& other)
   {
-    return values_.clear();
+    if (&other == this) {
+      return;
+    }
+    values_.insert(
+          pos
+        , std::make_move_iterator(other.values_.begin())
+        , std::make_move_iterator(other.values_.end()));
+    add_length(other.cached_length());
+    other.clear();
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::splice(
+        const_iterator const pos, list& other
+      , const_iterator const first, const_iterator const last)
+  {
+    if (&other == this) {
+      auto const it = [this](const_iterator const position)
+        { return std::next(values_.begin(), position - values_.cbegin()); };
+      if (pos < first) {
+        std::rotate(it(pos), it(first), it(last));
+      }
+      else if (last < pos) {
+        std::rotate(it(first), it(last), it(pos));
+      }
+      return;
+    }
+    auto const length = std::accumulate(
+          first, last, std::size_t{0}
+        , [](std::size_t const sum, const_reference v)
+          { return sum + v.byte_length(); });
+    auto const other_first
+      = std::next(other.values_.begin(), first - other.values_.cbegin());
+    values_.insert(
+          pos
+        , std::make_move_iterator(other_first)
+        , std::make_move_iterator(std::next(other_first, last - first)));
+    add_length(length);
+    other.values_.erase(first, last);
+    other.subtract_length(length);
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::swap(list& other)
+  {
+    list_detail::swap_values(values_, other.values_);
+    std::swap(byte_length_, other.byte_length_);
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::clear() noexcept
+  {
+    values_.clear();
+    byte_length_ = 0;
   }
 
   // OFP operations:
-  template <class ProtocolType>
-  auto list<ProtocolType>::calc_ofp_length(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::calc_ofp_length(
       std::uint16_t const base_length) const
     -> std::uint16_t
   {
@@ -299,61 +445,59 @@ namespace ofp {
     if (size() > (max_length / value_type::min_byte_length())) {
       throw std::runtime_error{"too many elements"};
     }
-    auto const total_length = length_impl();
+    auto const total_length = cached_length();
     if (total_length > max_length) {
       throw std::runtime_error{"too large length"};
     }
     return total_length + base_length;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::length() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::length() const noexcept
     -> std::size_t
   {
-    return length_impl();
+    return cached_length();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::byte_length() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::byte_length() const noexcept
     -> std::size_t
   {
-    return length_impl();
+    return cached_length();
   }
 
   // private operations:
-  template <class ProtocolType>
-  list<ProtocolType>::list(container_type&& values)
-    : values_(std::move(values))
-  {
-  }
-
-  template <class ProtocolType>
-  auto list<ProtocolType>::init_impl(value_type&& value)
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::init_impl(value_type&& value)
     -> list_detail::dummy_type
   {
     values_.push_back(std::move(value));
+    byte_length_ += values_.back().byte_length();
     return list_detail::dummy_type{};
   }
 
-  template <class ProtocolType>
-  void list<ProtocolType>::assign_impl(
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::assign_impl(
       value_type* const first, value_type* const last)
   {
     values_.assign(
         std::make_move_iterator(first), std::make_move_iterator(last));
+    byte_length_ = length_impl();
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::insert_impl(
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::insert_impl(
       const_iterator const pos, value_type* const first, value_type* const last)
     -> iterator
   {
-    return values_.insert(
+    auto const it = values_.insert(
         pos, std::make_move_iterator(first), std::make_move_iterator(last));
+    add_length(it, last - first);
+    return it;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::length_impl() const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::length_impl() const noexcept
     -> std::size_t
   {
     return boost::accumulate(
@@ -362,15 +506,61 @@ namespace ofp {
           { return sum + v.byte_length(); });
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::equal_impl(list const& rhs) const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::cached_length() const noexcept
+    -> std::size_t
+  {
+    return byte_length_ != list_detail::unknown_length()
+      ? byte_length_
+      : length_impl();
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::add_length(
+      std::size_t const length) noexcept
+  {
+    if (byte_length_ != list_detail::unknown_length()) {
+      byte_length_ += length;
+    }
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::add_length(
+      const_iterator const first, size_type const n) noexcept
+  {
+    if (byte_length_ != list_detail::unknown_length()) {
+      byte_length_ = std::accumulate(
+            first, first + n, byte_length_
+          , [](std::size_t const sum, const_reference v)
+            { return sum + v.byte_length(); });
+    }
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::subtract_length(
+      std::size_t const length) noexcept
+  {
+    if (byte_length_ != list_detail::unknown_length()) {
+      byte_length_ -= length;
+    }
+  }
+
+  template <class ProtocolType, class Allocator>
+  void list<ProtocolType, Allocator>::invalidate_length() noexcept
+  {
+    byte_length_ = list_detail::unknown_length();
+  }
+
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::equal_impl(list const& rhs) const noexcept
     -> bool
   {
     return values_ == rhs.values_;
   }
 
-  template <class ProtocolType>
-  auto list<ProtocolType>::equivalent_impl(list const& rhs) const noexcept
+  template <class ProtocolType, class Allocator>
+  auto list<ProtocolType, Allocator>::equivalent_impl(
+      list const& rhs) const noexcept
     -> bool
   {
     return boost::equal(
@@ -117,7 +117,7 @@ namespace detail {
   }
 
   template <class Derived, class Key, class T>
-  void set_base<Derived, Key, T>::swap(set_base& other) noexcept
+  void set_base<Derived, Key, T>::swap(set_base& other)
   {
     list_.swap(other.list_);
   }
@@ -221,8 +221,9 @@ namespace detail {
   };
 
   template <class Derived, class Key, class T>
-  auto set_base<Derived, Key, T>::non_const_lower_bound(key_type const key)
-    -> typename list_type::iterator
+  auto set_base<Derived, Key, T>::lower_bound_impl(
+      key_type const key) const noexcept
+    -> const_iterator
   {
     return boost::lower_bound(
           list_
@@ -111,8 +111,8 @@ namespace detail {
       -> std::pair<const_iterator, bool>
     {
       auto const key = get_key(u);
-      auto const pos = non_const_lower_bound(key);
-      if (pos != list_.end() && get_key(*pos) == key) {
+      auto const pos = lower_bound_impl(key);
+      if (pos != list_.cend() && get_key(*pos) == key) {
         return std::make_pair(const_iterator{pos}, false);
       }
       else {
@@ -126,13 +126,13 @@ namespace detail {
       -> std::pair<const_iterator, bool>
     {
       auto const key = get_key(u);
-      auto const pos = non_const_lower_bound(key);
-      if (pos != list_.end() && get_key(*pos) == key) {
-        *pos = std::forward<U>(u);
-        return std::make_pair(const_iterator{pos}, true);
+      auto const pos = lower_bound_impl(key);
+      if (pos != list_.cend() && get_key(*pos) == key) {
+        auto const it = list_.replace(pos, value_type{std::forward<U>(u)});
+        return std::make_pair(const_iterator{it}, true);
       }
       else {
-        return std::make_pair(const_iterator{list_.end()}, false);
+        return std::make_pair(const_iterator{list_.cend()}, false);
       }
     }
 
@@ -141,10 +141,10 @@ namespace detail {
       -> std::pair<const_iterator, bool>
     {
       auto const key = get_key(u);
-      auto const pos = non_const_lower_bound(key);
-      if (pos != list_.end() && get_key(*pos) == key) {
-        *pos = std::forward<U>(u);
-        return std::make_pair(const_iterator{pos}, false);
+      auto const pos = lower_bound_impl(key);
+      if (pos != list_.cend() && get_key(*pos) == key) {
+        auto const it = list_.replace(pos, value_type{std::forward<U>(u)});
+        return std::make_pair(const_iterator{it}, false);
       }
       else {
         auto const it = list_.insert(pos, value_type{std::forward<U>(u)});
@@ -160,14 +160,14 @@ namespace detail {
       -> size_type
     {
       auto const it = find(key<U>());
-      if (it == list_.end()) {
+      if (it == list_.cend()) {
         return 0;
       }
       list_.erase(it);
       return 1;
     }
 
-    CANARD_NET_OFP_DECL void swap(set_base&) noexcept;
+    CANARD_NET_OFP_DECL void swap(set_base&);
 
     CANARD_NET_OFP_DECL void clear() noexcept;
 
@@ -217,8 +217,8 @@ namespace detail {
     class default_set_info;
 
   private:
-    CANARD_NET_OFP_DECL auto non_const_lower_bound(key_type)
-      -> typename list_type::iterator;
+    CANARD_NET_OFP_DECL auto lower_bound_impl(key_type) const noexcept
+      -> const_iterator;
 
     CANARD_NET_OFP_DECL auto equal_impl(set_base const&) const noexcept
       -> bool;
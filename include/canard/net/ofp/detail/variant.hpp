@@ -2,6 +2,7 @@
 #define CANARD_NET_OFP_DETAIL_VARIANT_HPP
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #if defined(CANARD_NET_OFP_USE_MAPBOX_VARIANT)
@@ -75,7 +76,7 @@ namespace ofp {
 } // namespace net
 } // namespace canard
 
-#else
+#elif defined(CANARD_NET_OFP_USE_BOOST_VARIANT)
 
 # include <boost/variant/apply_visitor.hpp>
 # include <boost/variant/get.hpp>
@@ -136,6 +137,130 @@ namespace ofp {
 } // namespace net
 } // namespace canard
 
+#else
+
+# include <canard/net/ofp/detail/compact_variant.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace detail {
+
+  template <class... Types>
+  using variant = compact_variant<Types...>;
+
+  template <class TypeList>
+  struct make_variant_over;
+  template <template <class...> class TypeList, class... Types>
+  struct make_variant_over<TypeList<Types...>>
+  {
+    using type = compact_variant<Types...>;
+  };
+
+  namespace variant_detail {
+
+    template <class F, class Rhs>
+    struct binary_visitor_lhs
+    {
+      using result_type = typename std::remove_reference<F>::type::result_type;
+
+      template <class T>
+      struct bound
+      {
+        using result_type = binary_visitor_lhs::result_type;
+
+        template <class U>
+        auto operator()(U&& rhs) const
+          -> result_type
+        {
+          return (*f)(*lhs, std::forward<U>(rhs));
+        }
+
+        typename std::remove_reference<F>::type* f;
+        T* lhs;
+      };
+
+      template <class T>
+      auto operator()(T& lhs) const
+        -> result_type
+      {
+        return rhs->visit_impl(bound<T>{f, std::addressof(lhs)});
+      }
+
+      typename std::remove_reference<F>::type* f;
+      Rhs* rhs;
+    };
+
+  } // namespace variant_detail
+
+  template <class F, class... Types>
+  auto apply_visitor(F&& f, compact_variant<Types...>& v)
+    -> typename std::remove_reference<F>::type::result_type
+  {
+    return v.visit_impl(f);
+  }
+
+  template <class F, class... Types>
+  auto apply_visitor(F&& f, compact_variant<Types...> const& v)
+    -> typename std::remove_reference<F>::type::result_type
+  {
+    return v.visit_impl(f);
+  }
+
+  template <class F, class Lhs, class Rhs>
+  auto apply_visitor(F&& f, Lhs& lhs, Rhs& rhs)
+    -> typename std::remove_reference<F>::type::result_type
+  {
+    return lhs.visit_impl(variant_detail::binary_visitor_lhs<F, Rhs>{
+        std::addressof(f), std::addressof(rhs)
+    });
+  }
+
+  template <class ResultType, class... Types>
+  auto get(compact_variant<Types...>& v)
+    -> ResultType&
+  {
+    if (!v.template is<ResultType>()) {
+      throw bad_get{};
+    }
+    return v.template unsafe_get<ResultType>();
+  }
+
+  template <class ResultType, class... Types>
+  auto get(compact_variant<Types...> const& v)
+    -> ResultType const&
+  {
+    if (!v.template is<ResultType>()) {
+      throw bad_get{};
+    }
+    return v.template unsafe_get<ResultType>();
+  }
+
+  template <class ResultType, class... Types>
+  auto get(compact_variant<Types...>* const v) noexcept
+    -> ResultType*
+  {
+    if (!v->template is<ResultType>()) {
+      return nullptr;
+    }
+    return std::addressof(v->template unsafe_get<ResultType>());
+  }
+
+  template <class ResultType, class... Types>
+  auto get(compact_variant<Types...> const* const v) noexcept
+    -> ResultType const*
+  {
+    if (!v->template is<ResultType>()) {
+      return nullptr;
+    }
+    return std::addressof(v->template unsafe_get<ResultType>());
+  }
+
+} // namespace detail
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
 #endif
 
 #endif // CANARD_NET_OFP_DETAIL_VARIANT_HPP
@@ -0,0 +1,132 @@
+#ifndef CANARD_NET_OFP_GATHER_BUFFER_HPP
+#define CANARD_NET_OFP_GATHER_BUFFER_HPP
+
+#include <cstddef>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  // An encoding buffer for gathering writes. Header and TLV bytes are
+  // copied to an internal scratch area, while payloads passed to
+  // detail::encode_payload which are not smaller than the reference
+  // threshold are referenced in place. The payloads must outlive the
+  // buffer sequence returned by buffers().
+  class gather_buffer
+  {
+  public:
+    using const_buffers_type = std::vector<boost::asio::const_buffer>;
+
+    static constexpr std::size_t default_reference_threshold = 256;
+
+    explicit gather_buffer(
+        std::size_t const reference_threshold = default_reference_threshold)
+      : reference_threshold_(reference_threshold)
+      , size_(0)
+    {
+    }
+
+    auto reference_threshold() const noexcept
+      -> std::size_t
+    {
+      return reference_threshold_;
+    }
+
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return size_;
+    }
+
+    auto scratch_size() const noexcept
+      -> std::size_t
+    {
+      return scratch_.size();
+    }
+
+    auto buffers() const
+      -> const_buffers_type
+    {
+      auto buffers = const_buffers_type{};
+      buffers.reserve(segments_.size());
+      for (auto const& segment : segments_) {
+        buffers.emplace_back(
+              segment.data ? segment.data : scratch_.data() + segment.offset
+            , segment.size);
+      }
+      return buffers;
+    }
+
+    void append(unsigned char const* const first, std::size_t const size)
+    {
+      if (size == 0) {
+        return;
+      }
+      if (segments_.empty() || segments_.back().data) {
+        segments_.push_back(segment{nullptr, scratch_.size(), 0});
+      }
+      scratch_.insert(scratch_.end(), first, first + size);
+      segments_.back().size += size;
+      size_ += size;
+    }
+
+    void append_reference(
+        unsigned char const* const first, std::size_t const size)
+    {
+      if (size < reference_threshold_) {
+        append(first, size);
+        return;
+      }
+      segments_.push_back(segment{first, 0, size});
+      size_ += size;
+    }
+
+    friend void append_bytes(
+          gather_buffer& buffer
+        , unsigned char const* const first, std::size_t const size)
+    {
+      buffer.append(first, size);
+    }
+
+    friend void append_payload(
+          gather_buffer& buffer
+        , unsigned char const* const first, std::size_t const size)
+    {
+      buffer.append_reference(first, size);
+    }
+
+    void reserve(std::size_t const scratch_size)
+    {
+      scratch_.reserve(scratch_size);
+    }
+
+    void clear() noexcept
+    {
+      scratch_.clear();
+      segments_.clear();
+      size_ = 0;
+    }
+
+  private:
+    // data is null for bytes in the scratch area, which are located by
+    // offset as the scratch area may be reallocated.
+    struct segment
+    {
+      unsigned char const* data;
+      std::size_t offset;
+      std::size_t size;
+    };
+
+    std::size_t reference_threshold_;
+    std::size_t size_;
+    std::vector<unsigned char> scratch_;
+    std::vector<segment> segments_;
+  };
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_GATHER_BUFFER_HPP
@@ -8,11 +8,27 @@ namespace canard {
 namespace net {
 namespace ofp {
 
+  namespace get_xid_detail {
+
+    constexpr std::uint32_t block_size = 256;
+
+  } // namespace get_xid_detail
+
+  // Each thread takes a block of xids from the shared counter at a time,
+  // so xids are unique across threads but only consecutive within one.
   inline auto get_xid() noexcept
     -> std::uint32_t
   {
-    static std::atomic<std::uint32_t> xid{0};
-    return xid.fetch_add(1, std::memory_order_relaxed);
+    static std::atomic<std::uint32_t> next_block{0};
+    static thread_local std::uint32_t xid = 0;
+    static thread_local std::uint32_t remaining = 0;
+    if (remaining == 0) {
+      xid = next_block.fetch_add(
+          get_xid_detail::block_size, std::memory_order_relaxed);
+      remaining = get_xid_detail::block_size;
+    }
+    --remaining;
+    return xid++;
   }
 
 } // namespace ofp
@@ -3,17 +3,22 @@
 
 #include <canard/net/ofp/detail/config.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
 #include <boost/operators.hpp>
 #include <boost/range/algorithm/for_each.hpp>
+#include <canard/net/ofp/detail/container_allocator.hpp>
+#include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/type_traits/is_all_constructible.hpp>
 #include <canard/net/ofp/type_traits/is_iterator.hpp>
+#include <canard/net/ofp/type_traits/list_inline_capacity.hpp>
 
 namespace canard {
 namespace net {
@@ -72,13 +77,120 @@ namespace ofp {
       return header_size_impl<ProtocolType>::value;
     }
 
+    template <class T>
+    auto has_byte_length_from_header_impl(T const&)
+      -> decltype(
+            T::byte_length_from_header(
+              std::declval<typename T::header_type const&>())
+          , std::true_type{});
+
+    auto has_byte_length_from_header_impl(...)
+      -> std::false_type;
+
+    template <class T>
+    struct has_byte_length_from_header
+        : decltype(has_byte_length_from_header_impl(std::declval<T>()))
+    {};
+
+    // Walks only the length fields of the elements. Returns zero if they
+    // do not chain up to last, and leaves reporting the error to the
+    // decoder of the element.
+    template <class ProtocolType, class Iterator>
+    auto count_elements(Iterator first, Iterator const last, std::true_type)
+      -> std::size_t
+    {
+      using header_type = typename ProtocolType::header_type;
+      auto n = std::size_t{0};
+      while (std::distance(first, last) >= header_size<ProtocolType>()) {
+        auto const length = ProtocolType::byte_length_from_header(
+            detail::decode_without_consumption<header_type>(first, last));
+        if (length < ProtocolType::min_byte_length()
+            || length > std::distance(first, last)) {
+          return 0;
+        }
+        std::advance(first, length);
+        ++n;
+      }
+      return first == last ? n : 0;
+    }
+
+    template <class ProtocolType, class Iterator>
+    auto count_elements(Iterator, Iterator, std::false_type) noexcept
+      -> std::size_t
+    {
+      return 0;
+    }
+
+    constexpr auto unknown_length() noexcept
+      -> std::size_t
+    {
+      return std::size_t(-1);
+    }
+
+    template <
+        class ProtocolType, class Allocator
+      , std::size_t N = type_traits::list_inline_capacity<ProtocolType>::value
+    >
+    struct container
+    {
+      using type = boost::container::small_vector<ProtocolType, N, Allocator>;
+    };
+
+    template <class ProtocolType, class Allocator>
+    struct container<ProtocolType, Allocator, 0>
+    {
+      using type = boost::container::vector<ProtocolType, Allocator>;
+    };
+
+    // small_vector derives the noexcept of its move constructor from the
+    // copy assignment of the elements, but the move only steals the buffer
+    // or move-constructs the inline elements
+    template <class Container>
+    struct is_nothrow_move_constructible
+      : std::is_nothrow_move_constructible<Container>
+    {};
+
+    template <class T, std::size_t N, class Allocator>
+    struct is_nothrow_move_constructible<
+      boost::container::small_vector<T, N, Allocator>
+    >
+      : std::is_nothrow_move_constructible<T>
+    {};
+
+    template <class T, class Allocator>
+    void swap_values(
+          boost::container::vector<T, Allocator>& lhs
+        , boost::container::vector<T, Allocator>& rhs)
+    {
+      lhs.swap(rhs);
+    }
+
+    // small_vector::swap move-assigns inline elements, which makes
+    // variant-based elements fall back to heap backup storage;
+    // moving them into cleared storage constructs them instead
+    template <class T, std::size_t N, class Allocator>
+    void swap_values(
+          boost::container::small_vector<T, N, Allocator>& lhs
+        , boost::container::small_vector<T, N, Allocator>& rhs)
+    {
+      auto tmp = std::move(lhs);
+      lhs.clear();
+      lhs = std::move(rhs);
+      rhs.clear();
+      rhs = std::move(tmp);
+    }
+
   } // namespace list_detail
 
-  template <class ProtocolType>
+  template <
+      class ProtocolType
+    , class Allocator = detail::container_allocator<ProtocolType>
+  >
   class list
-    : private boost::equality_comparable<list<ProtocolType>>
+    : private boost::equality_comparable<list<ProtocolType, Allocator>>
   {
-    using container_type = boost::container::vector<ProtocolType>;
+    using container_type
+      = typename list_detail::container<ProtocolType, Allocator>::type;
 
   public:
     // types:
@@ -89,6 +201,7 @@ namespace ofp {
     using const_iterator = typename container_type::const_iterator;
     using difference_type = typename container_type::difference_type;
     using size_type = typename container_type::size_type;
+    using allocator_type = Allocator;
 
     using reverse_iterator = typename container_type::reverse_iterator;
     using const_reverse_iterator
@@ -97,6 +210,8 @@ namespace ofp {
     // construct:
     list();
 
+    CANARD_NET_OFP_DECL explicit list(allocator_type const&);
+
     CANARD_NET_OFP_DECL list(size_type, const_reference);
 
     template <
@@ -105,6 +220,7 @@ namespace ofp {
     >
     list(InputIterator first, InputIterator last)
       : values_(first, last)
+      , byte_length_(length_impl())
     {
     }
 
@@ -127,9 +243,24 @@ namespace ofp {
     >
     list(List const init_list)
       : values_(init_list)
+      , byte_length_(length_impl())
     {
     }
 
+    list(list const&) = default;
+
+    CANARD_NET_OFP_DECL list(list&&)
+      noexcept(list_detail::is_nothrow_move_constructible<
+          container_type
+      >::value);
+
+    auto operator=(list const&)
+      -> list& = default;
+
+    CANARD_NET_OFP_DECL auto operator=(list&&)
+      noexcept(std::is_nothrow_move_assignable<container_type>::value)
+      -> list&;
+
     CANARD_NET_OFP_DECL auto operator=(std::initializer_list<value_type>)
       -> list&;
 
@@ -140,6 +271,7 @@ namespace ofp {
     void assign(InputIterator first, InputIterator last)
     {
       values_.assign(first, last);
+      byte_length_ = length_impl();
     }
 
     CANARD_NET_OFP_DECL void assign(size_type, const_reference);
@@ -156,6 +288,9 @@ namespace ofp {
       return assign_impl(std::begin(init_list), std::end(init_list));
     }
 
+    CANARD_NET_OFP_DECL auto get_allocator() const noexcept
+      -> allocator_type;
+
     // iterators:
     CANARD_NET_OFP_DECL auto begin() noexcept
       -> iterator;
@@ -203,6 +338,9 @@ namespace ofp {
     CANARD_NET_OFP_DECL auto empty() const noexcept
       -> bool;
 
+    CANARD_NET_OFP_DECL auto capacity() const noexcept
+      -> size_type;
+
     CANARD_NET_OFP_DECL void reserve(size_type);
 
     CANARD_NET_OFP_DECL void shrink_to_fit();
@@ -237,6 +375,7 @@ namespace ofp {
     void emplace_back(Args&&... args)
     {
       values_.emplace_back(std::forward<Args>(args)...);
+      add_length(values_.back().byte_length());
     }
 
     CANARD_NET_OFP_DECL void push_back(value_type const&);
@@ -249,7 +388,9 @@ namespace ofp {
     auto emplace(const_iterator const pos, Args&&... args)
       -> iterator
     {
-      return values_.emplace(pos, std::forward<Args>(args)...);
+      auto const it = values_.emplace(pos, std::forward<Args>(args)...);
+      add_length(it->byte_length());
+      return it;
     }
 
     template <
@@ -271,7 +412,10 @@ namespace ofp {
           const_iterator const pos, InputIterator first, InputIterator last)
       -> list_detail::enable_if_is_input_iterator_t<InputIterator, iterator>
     {
-      return values_.insert(pos, first, last);
+      auto const size = values_.size();
+      auto const it = values_.insert(pos, first, last);
+      add_length(it, values_.size() - size);
+      return it;
     }
 
     CANARD_NET_OFP_DECL auto insert(
@@ -284,7 +428,21 @@ namespace ofp {
     CANARD_NET_OFP_DECL auto erase(const_iterator, const_iterator)
       -> iterator;
 
-    CANARD_NET_OFP_DECL void swap(list&) noexcept;
+    // replaces the element at the position, as assigning to it would
+    CANARD_NET_OFP_DECL auto replace(const_iterator, value_type const&)
+      -> iterator;
+
+    CANARD_NET_OFP_DECL auto replace(const_iterator, value_type&&)
+      -> iterator;
+
+    // moves the elements of another list before the position;
+    // splicing a list into itself only reorders the range
+    CANARD_NET_OFP_DECL void splice(const_iterator, list&);
+
+    CANARD_NET_OFP_DECL void splice(
+        const_iterator, list&, const_iterator, const_iterator);
+
+    CANARD_NET_OFP_DECL void swap(list&);
 
     CANARD_NET_OFP_DECL void clear() noexcept;
 
@@ -316,17 +474,47 @@ namespace ofp {
     static auto decode(Iterator& first, Iterator last)
       -> list
     {
-      auto values = container_type{};
-      values.reserve(
-          std::distance(first, last) / value_type::min_byte_length());
+      // decoded into the returned list itself,
+      // since moving inline elements is not free
+      auto result = list{};
+      auto& values = result.values_;
+      reserve_for_decode(values, first, last);
       while (std::distance(first, last)
           >= list_detail::header_size<value_type>()) {
+        reserve_next_for_decode(values, first, last);
         values.push_back(value_type::decode(first, last));
+        result.byte_length_ += values.back().byte_length();
       }
       if (first != last) {
         throw std::runtime_error{"list byte length is invalid"};
       }
-      return list{std::move(values)};
+      return result;
+    }
+
+    // Policy is a decode policy of the protocol version, through which a
+    // malformed element or a byte length not ending at last is reported.
+    template <class Iterator, class Policy>
+    static auto decode(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<list>
+    {
+      auto result = list{};
+      auto& values = result.values_;
+      reserve_for_decode(values, first, last);
+      while (std::distance(first, last)
+          >= list_detail::header_size<value_type>()) {
+        reserve_next_for_decode(values, first, last);
+        auto value = value_type::decode(first, last, policy);
+        if (Policy::failed(value)) {
+          return Policy::template error<list>(Policy::error_of(value));
+        }
+        values.push_back(std::move(Policy::value_of(value)));
+        result.byte_length_ += values.back().byte_length();
+      }
+      if (first != last) {
+        return Policy::template length_error<list>(
+            "list byte length is invalid");
+      }
+      return result;
     }
 
     friend auto operator==(list const& lhs, list const& rhs) noexcept
@@ -342,7 +530,32 @@ namespace ofp {
     }
 
   private:
-    CANARD_NET_OFP_DECL explicit list(container_type&&);
+    // scanned only if the elements may not fit in the inline storage
+    template <class Iterator>
+    static void reserve_for_decode(
+        container_type& values, Iterator first, Iterator last)
+    {
+      if (std::size_t(std::distance(first, last))
+            / value_type::min_byte_length() > values.capacity()) {
+        auto const num_elements = list_detail::count_elements<value_type>(
+              first, last
+            , list_detail::has_byte_length_from_header<value_type>{});
+        if (num_elements > values.capacity()) {
+          values.reserve(num_elements);
+        }
+      }
+    }
+
+    // the inline storage is used up before reserving the upper bound
+    template <class Iterator>
+    static void reserve_next_for_decode(
+        container_type& values, Iterator first, Iterator last)
+    {
+      if (values.size() == values.capacity()) {
+        values.reserve(values.size()
+            + std::distance(first, last) / value_type::min_byte_length());
+      }
+    }
 
     CANARD_NET_OFP_DECL auto init_impl(value_type&&)
       -> list_detail::dummy_type;
@@ -356,6 +569,17 @@ namespace ofp {
     CANARD_NET_OFP_DECL auto length_impl() const noexcept
       -> std::size_t;
 
+    CANARD_NET_OFP_DECL auto cached_length() const noexcept
+      -> std::size_t;
+
+    CANARD_NET_OFP_DECL void add_length(std::size_t) noexcept;
+
+    CANARD_NET_OFP_DECL void add_length(const_iterator, size_type) noexcept;
+
+    CANARD_NET_OFP_DECL void subtract_length(std::size_t) noexcept;
+
+    CANARD_NET_OFP_DECL void invalidate_length() noexcept;
+
     CANARD_NET_OFP_DECL auto equal_impl(list const&) const noexcept
       -> bool;
 
@@ -364,10 +588,19 @@ namespace ofp {
 
   private:
     container_type values_;
+
+    // Sum of byte_length() of all elements, maintained by the modifiers.
+    // Non-const element access may change the elements through references
+    // the caller keeps, so it makes the length unknown, and the length is
+    // then recomputed on each query until the elements are replaced as a
+    // whole by assign, clear or decode.
+    std::size_t byte_length_ = 0;
   };
 
-  template <class ProtocolType>
-  void swap(list<ProtocolType>& lhs, list<ProtocolType>& rhs) noexcept
+  template <class ProtocolType, class Allocator>
+  void swap(
+      list<ProtocolType, Allocator>& lhs
+    , list<ProtocolType, Allocator>& rhs)
   {
     lhs.swap(rhs);
   }
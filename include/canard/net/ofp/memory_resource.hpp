@@ -0,0 +1,189 @@
+#ifndef CANARD_NET_OFP_MEMORY_RESOURCE_HPP
+#define CANARD_NET_OFP_MEMORY_RESOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <new>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  class memory_resource
+  {
+  public:
+    static constexpr std::size_t max_align = alignof(std::max_align_t);
+
+    virtual ~memory_resource() = default;
+
+    auto allocate(
+        std::size_t const bytes, std::size_t const alignment = max_align)
+      -> void*
+    {
+      return do_allocate(bytes, alignment);
+    }
+
+    void deallocate(
+          void* const ptr, std::size_t const bytes
+        , std::size_t const alignment = max_align)
+    {
+      do_deallocate(ptr, bytes, alignment);
+    }
+
+  private:
+    virtual auto do_allocate(std::size_t bytes, std::size_t alignment)
+      -> void* = 0;
+
+    virtual void do_deallocate(
+        void* ptr, std::size_t bytes, std::size_t alignment) = 0;
+  };
+
+  // hands out memory from a growing sequence of chunks and frees all of it
+  // at once on release() or destruction; deallocate is a no-op
+  class monotonic_buffer_resource final
+    : public memory_resource
+  {
+    struct chunk_header
+    {
+      chunk_header* next;
+    };
+
+  public:
+    explicit monotonic_buffer_resource(std::size_t const initial_size = 4096)
+      : chunks_(nullptr)
+      , initial_buffer_(nullptr)
+      , initial_size_(0)
+      , current_(nullptr)
+      , remaining_(0)
+      , initial_chunk_size_(std::max(initial_size, std::size_t{64}))
+      , next_chunk_size_(initial_chunk_size_)
+    {
+    }
+
+    monotonic_buffer_resource(void* const buffer, std::size_t const size)
+      : chunks_(nullptr)
+      , initial_buffer_(static_cast<unsigned char*>(buffer))
+      , initial_size_(size)
+      , current_(initial_buffer_)
+      , remaining_(size)
+      , initial_chunk_size_(std::max(size * 2, std::size_t{64}))
+      , next_chunk_size_(initial_chunk_size_)
+    {
+    }
+
+    monotonic_buffer_resource(monotonic_buffer_resource const&) = delete;
+    auto operator=(monotonic_buffer_resource const&)
+      -> monotonic_buffer_resource& = delete;
+
+    ~monotonic_buffer_resource()
+    {
+      release();
+    }
+
+    void release() noexcept
+    {
+      while (chunks_) {
+        auto const next = chunks_->next;
+        ::operator delete(chunks_);
+        chunks_ = next;
+      }
+      current_ = initial_buffer_;
+      remaining_ = initial_size_;
+      next_chunk_size_ = initial_chunk_size_;
+    }
+
+  private:
+    auto do_allocate(std::size_t const bytes, std::size_t const alignment)
+      -> void* override
+    {
+      if (auto const ptr = allocate_from_current(bytes, alignment)) {
+        return ptr;
+      }
+      auto const chunk_size = std::max(
+          next_chunk_size_, sizeof(chunk_header) + bytes + alignment);
+      auto const chunk
+        = static_cast<chunk_header*>(::operator new(chunk_size));
+      chunk->next = chunks_;
+      chunks_ = chunk;
+      current_ = reinterpret_cast<unsigned char*>(chunk + 1);
+      remaining_ = chunk_size - sizeof(chunk_header);
+      next_chunk_size_ = chunk_size * 2;
+      return allocate_from_current(bytes, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override
+    {
+    }
+
+    auto allocate_from_current(
+        std::size_t const bytes, std::size_t const alignment) noexcept
+      -> void*
+    {
+      auto const address = reinterpret_cast<std::uintptr_t>(current_);
+      auto const padding = (alignment - address % alignment) % alignment;
+      if (remaining_ < padding || remaining_ - padding < bytes) {
+        return nullptr;
+      }
+      auto const ptr = current_ + padding;
+      current_ = ptr + bytes;
+      remaining_ -= padding + bytes;
+      return ptr;
+    }
+
+  private:
+    chunk_header* chunks_;
+    unsigned char* initial_buffer_;
+    std::size_t initial_size_;
+    unsigned char* current_;
+    std::size_t remaining_;
+    std::size_t initial_chunk_size_;
+    std::size_t next_chunk_size_;
+  };
+
+  namespace memory_resource_detail {
+
+    inline auto current() noexcept
+      -> memory_resource*&
+    {
+      static thread_local memory_resource* resource = nullptr;
+      return resource;
+    }
+
+  } // namespace memory_resource_detail
+
+  // the resource used by containers constructed on this thread;
+  // nullptr means the global operator new
+  inline auto current_memory_resource() noexcept
+    -> memory_resource*
+  {
+    return memory_resource_detail::current();
+  }
+
+  class scoped_memory_resource
+  {
+  public:
+    explicit scoped_memory_resource(memory_resource& resource) noexcept
+      : previous_(memory_resource_detail::current())
+    {
+      memory_resource_detail::current() = &resource;
+    }
+
+    scoped_memory_resource(scoped_memory_resource const&) = delete;
+    auto operator=(scoped_memory_resource const&)
+      -> scoped_memory_resource& = delete;
+
+    ~scoped_memory_resource()
+    {
+      memory_resource_detail::current() = previous_;
+    }
+
+  private:
+    memory_resource* previous_;
+  };
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_MEMORY_RESOURCE_HPP
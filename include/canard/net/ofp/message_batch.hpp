@@ -0,0 +1,217 @@
+#ifndef CANARD_NET_OFP_MESSAGE_BATCH_HPP
+#define CANARD_NET_OFP_MESSAGE_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+#include <canard/net/ofp/get_xid.hpp>
+#include <canard/net/ofp/raw_buffer.hpp>
+#include <canard/net/ofp/v10/openflow.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  // Encodes messages of one protocol version back to back.
+  //
+  // With a chunk size of zero, all messages are held in one growing buffer.
+  // Otherwise they are held in a chain of chunks of that size, and a message
+  // is never split across chunks; a message larger than the chunk size gets
+  // a chunk of its own. Buffers are kept by clear() for the next batch.
+  class message_batch
+  {
+  public:
+    using buffer_type = std::vector<unsigned char>;
+    using const_buffers_type = std::vector<boost::asio::const_buffer>;
+
+    static constexpr std::size_t header_size = 8;
+
+    explicit message_batch(
+        std::uint8_t const version, std::size_t const chunk_size = 0)
+      : chunk_size_(chunk_size)
+      , num_chunks_(0)
+      , size_(0)
+      , byte_length_(0)
+      , barrier_interval_(0)
+      , since_barrier_(0)
+      , next_xid_(0)
+      , assigns_xid_(false)
+      , version_(version)
+    {
+    }
+
+    auto version() const noexcept
+      -> std::uint8_t
+    {
+      return version_;
+    }
+
+    auto chunk_size() const noexcept
+      -> std::size_t
+    {
+      return chunk_size_;
+    }
+
+    // number of messages, including the inserted barrier requests
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return size_;
+    }
+
+    auto empty() const noexcept
+      -> bool
+    {
+      return size_ == 0;
+    }
+
+    auto byte_length() const noexcept
+      -> std::size_t
+    {
+      return byte_length_;
+    }
+
+    auto num_chunks() const noexcept
+      -> std::size_t
+    {
+      return num_chunks_;
+    }
+
+    auto chunk(std::size_t const n) const noexcept
+      -> buffer_type const&
+    {
+      return chunks_[n];
+    }
+
+    auto buffers() const
+      -> const_buffers_type
+    {
+      auto buffers = const_buffers_type{};
+      buffers.reserve(num_chunks_);
+      for (auto i = std::size_t{0}; i < num_chunks_; ++i) {
+        buffers.emplace_back(chunks_[i].data(), chunks_[i].size());
+      }
+      return buffers;
+    }
+
+    // Overwrites the xid of each following message, including barrier
+    // requests, with consecutive values starting at xid.
+    void assign_xids_from(std::uint32_t const xid) noexcept
+    {
+      next_xid_ = xid;
+      assigns_xid_ = true;
+    }
+
+    // Inserts a barrier request after every n messages. Zero disables it.
+    void insert_barrier_every(std::size_t const n) noexcept
+    {
+      barrier_interval_ = n;
+      since_barrier_ = 0;
+    }
+
+    // returns the xid with which the message is encoded
+    template <class Message>
+    auto push_back(Message const& message)
+      -> std::uint32_t
+    {
+      if (message.version() != version_) {
+        throw std::invalid_argument{"message version mismatch"};
+      }
+      auto const length = std::size_t(message.byte_length());
+      auto& buffer = prepare(length);
+      auto const offset = buffer.size();
+      ofp::encode_exact(message, buffer);
+      auto const xid = commit(buffer, offset, length, message.xid());
+      if (barrier_interval_ != 0 && ++since_barrier_ == barrier_interval_) {
+        push_barrier_request();
+      }
+      return xid;
+    }
+
+    void clear() noexcept
+    {
+      for (auto i = std::size_t{0}; i < num_chunks_; ++i) {
+        chunks_[i].clear();
+      }
+      num_chunks_ = 0;
+      size_ = 0;
+      byte_length_ = 0;
+      since_barrier_ = 0;
+    }
+
+  private:
+    auto barrier_request_type() const noexcept
+      -> std::uint8_t
+    {
+      return version_ == v10::protocol::OFP_VERSION
+        ? std::uint8_t(v10::protocol::OFPT_BARRIER_REQUEST)
+        : std::uint8_t(v13::protocol::OFPT_BARRIER_REQUEST);
+    }
+
+    void push_barrier_request()
+    {
+      since_barrier_ = 0;
+      auto& buffer = prepare(header_size);
+      auto const offset = buffer.size();
+      unsigned char const header[header_size] = {
+        version_, barrier_request_type(), 0, header_size, 0, 0, 0, 0
+      };
+      buffer.insert(buffer.end(), header, header + header_size);
+      commit(buffer, offset, header_size, assigns_xid_ ? 0 : ofp::get_xid());
+    }
+
+    auto prepare(std::size_t const length)
+      -> buffer_type&
+    {
+      if (num_chunks_ == 0
+          || (chunk_size_ != 0
+            && chunks_[num_chunks_ - 1].size() + length > chunk_size_
+            && !chunks_[num_chunks_ - 1].empty())) {
+        if (num_chunks_ == chunks_.size()) {
+          chunks_.emplace_back();
+          chunks_.back().reserve(chunk_size_);
+        }
+        ++num_chunks_;
+      }
+      return chunks_[num_chunks_ - 1];
+    }
+
+    auto commit(
+          buffer_type& buffer, std::size_t const offset
+        , std::size_t const length, std::uint32_t xid) noexcept
+      -> std::uint32_t
+    {
+      if (assigns_xid_) {
+        xid = next_xid_++;
+      }
+      auto const header = buffer.data() + offset;
+      header[4] = xid >> 24;
+      header[5] = xid >> 16;
+      header[6] = xid >> 8;
+      header[7] = xid;
+      ++size_;
+      byte_length_ += length;
+      return xid;
+    }
+
+  private:
+    std::vector<buffer_type> chunks_;
+    std::size_t chunk_size_;
+    std::size_t num_chunks_;
+    std::size_t size_;
+    std::size_t byte_length_;
+    std::size_t barrier_interval_;
+    std::size_t since_barrier_;
+    std::uint32_t next_xid_;
+    bool assigns_xid_;
+    std::uint8_t version_;
+  };
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_MESSAGE_BATCH_HPP
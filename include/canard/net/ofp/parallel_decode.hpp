@@ -0,0 +1,153 @@
+#ifndef CANARD_NET_OFP_PARALLEL_DECODE_HPP
+#define CANARD_NET_OFP_PARALLEL_DECODE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/list.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  namespace parallel_decode_detail {
+
+    // Returns the first byte of each element followed by last, or an empty
+    // vector if the length fields do not chain up to last.
+    template <class ProtocolType>
+    auto scan_elements(
+        unsigned char const* first, unsigned char const* const last)
+      -> std::vector<unsigned char const*>
+    {
+      using header_type = typename ProtocolType::header_type;
+      auto offsets = std::vector<unsigned char const*>{};
+      while (std::size_t(last - first)
+          >= list_detail::header_size<ProtocolType>()) {
+        auto const length = std::size_t(ProtocolType::byte_length_from_header(
+            detail::decode_without_consumption<header_type>(first, last)));
+        if (length < ProtocolType::min_byte_length()
+            || length > std::size_t(last - first)) {
+          return {};
+        }
+        offsets.push_back(first);
+        first += length;
+      }
+      if (first != last) {
+        return {};
+      }
+      offsets.push_back(last);
+      return offsets;
+    }
+
+    // Splits the elements into num_parts runs of about the same byte length
+    // and returns the boundaries of the runs.
+    inline auto partition(
+          std::vector<unsigned char const*> const& offsets
+        , std::size_t const num_parts)
+      -> std::vector<unsigned char const*>
+    {
+      auto const first = offsets.front();
+      auto const total_length = std::size_t(offsets.back() - first);
+      auto boundaries = std::vector<unsigned char const*>{first};
+      for (auto i = std::size_t{1}; i < num_parts; ++i) {
+        auto const it = std::lower_bound(
+              offsets.begin(), offsets.end()
+            , first + total_length * i / num_parts);
+        if (*it != boundaries.back() && *it != offsets.back()) {
+          boundaries.push_back(*it);
+        }
+      }
+      boundaries.push_back(offsets.back());
+      return boundaries;
+    }
+
+  } // namespace parallel_decode_detail
+
+  // Decodes a list of elements which lead with their length, such as a
+  // flow_stats or group_description body, on up to num_threads threads
+  // including the calling one. The elements are scanned first, and each
+  // thread decodes a run of them into its own list. The runs are then moved
+  // into the returned list in order.
+  //
+  // Errors are reported as List::decode reports them. Each run is
+  // constructed on the thread decoding it, so the other threads never
+  // allocate from a scoped_memory_resource of the calling thread; only the
+  // returned list is, as the runs are moved into it on the calling thread.
+  // The nested lists of elements decoded on the other threads stay on the
+  // default heap.
+  template <class List>
+  auto parallel_decode(
+          unsigned char const*& first, unsigned char const* const last
+        , std::size_t const num_threads)
+    -> List
+  {
+    using value_type = typename List::value_type;
+    static_assert(
+          list_detail::has_byte_length_from_header<value_type>::value
+        , "element length must be known from its header");
+
+    auto const offsets
+      = parallel_decode_detail::scan_elements<value_type>(first, last);
+    auto const num_elements = offsets.empty() ? 0 : offsets.size() - 1;
+    if (std::min(num_threads, num_elements) <= 1) {
+      return List::decode(first, last);
+    }
+
+    auto const boundaries = parallel_decode_detail::partition(
+        offsets, std::min(num_threads, num_elements));
+    auto const num_parts = boundaries.size() - 1;
+    auto parts = std::vector<boost::optional<List>>(num_parts);
+    auto errors = std::vector<std::exception_ptr>(num_parts);
+    auto const decode_part = [&](std::size_t const i) {
+      try {
+        auto it = boundaries[i];
+        parts[i].emplace(List::decode(it, boundaries[i + 1]));
+      }
+      catch (...) {
+        errors[i] = std::current_exception();
+      }
+    };
+
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(num_parts - 1);
+    try {
+      for (auto i = std::size_t{1}; i < num_parts; ++i) {
+        workers.emplace_back(decode_part, i);
+      }
+    }
+    catch (...) {
+      for (auto& worker : workers) {
+        worker.join();
+      }
+      throw;
+    }
+    decode_part(0);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    for (auto const& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+    auto result = std::move(*parts[0]);
+    result.reserve(num_elements);
+    for (auto i = std::size_t{1}; i < num_parts; ++i) {
+      result.splice(result.cend(), *parts[i]);
+    }
+    first = last;
+    return result;
+  }
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_PARALLEL_DECODE_HPP
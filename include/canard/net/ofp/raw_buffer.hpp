@@ -0,0 +1,98 @@
+#ifndef CANARD_NET_OFP_RAW_BUFFER_HPP
+#define CANARD_NET_OFP_RAW_BUFFER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <boost/assert.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  class raw_buffer
+  {
+  public:
+    raw_buffer(unsigned char* const first, std::size_t const size) noexcept
+      : first_(first)
+      , current_(first)
+      , last_(first + size)
+    {
+    }
+
+    auto data() const noexcept
+      -> unsigned char*
+    {
+      return first_;
+    }
+
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return current_ - first_;
+    }
+
+    auto capacity() const noexcept
+      -> std::size_t
+    {
+      return last_ - first_;
+    }
+
+    auto end() const noexcept
+      -> unsigned char*
+    {
+      return current_;
+    }
+
+    void append(
+        unsigned char const* const first, std::size_t const size) noexcept
+    {
+      BOOST_ASSERT(std::size_t(last_ - current_) >= size);
+      std::memcpy(current_, first, size);
+      current_ += size;
+    }
+
+    friend void append_bytes(
+          raw_buffer& buffer
+        , unsigned char const* const first, std::size_t const size) noexcept
+    {
+      buffer.append(first, size);
+    }
+
+  private:
+    unsigned char* first_;
+    unsigned char* current_;
+    unsigned char* last_;
+  };
+
+  template <class T>
+  auto encode_to(T const& t, unsigned char* const first, std::size_t const size)
+    -> unsigned char*
+  {
+    if (t.byte_length() > size) {
+      throw std::runtime_error{"too small buffer size"};
+    }
+    auto buffer = raw_buffer{first, size};
+    t.encode(buffer);
+    return buffer.end();
+  }
+
+  template <class T, class Container>
+  auto encode_exact(T const& t, Container& container)
+    -> Container&
+  {
+    auto const offset = container.size();
+    auto const length = std::size_t(t.byte_length());
+    container.resize(offset + length);
+    auto buffer = raw_buffer{
+      reinterpret_cast<unsigned char*>(container.data()) + offset, length
+    };
+    t.encode(buffer);
+    return container;
+  }
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_RAW_BUFFER_HPP
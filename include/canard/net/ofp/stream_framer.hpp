@@ -0,0 +1,197 @@
+#ifndef CANARD_NET_OFP_STREAM_FRAMER_HPP
+#define CANARD_NET_OFP_STREAM_FRAMER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <boost/range/iterator_range.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+
+  enum class framer_error : std::uint8_t
+  {
+    none,
+    bad_version,
+    bad_length,
+  };
+
+  class stream_framer
+  {
+  public:
+    using message_range = boost::iterator_range<unsigned char const*>;
+    using buffer_range = boost::iterator_range<unsigned char*>;
+
+    static constexpr std::size_t header_size = 8;
+    static constexpr std::size_t max_message_size = 0xffff;
+    static constexpr std::size_t default_capacity = 2 * (max_message_size + 1);
+
+    explicit stream_framer(
+        std::uint8_t const version
+      , std::size_t const capacity = default_capacity)
+      : buffer_(new unsigned char[capacity])
+      , scratch_(new unsigned char[max_message_size])
+      , capacity_(capacity)
+      , first_(0)
+      , size_(0)
+      , version_(version)
+      , error_(framer_error::none)
+    {
+      if (capacity < max_message_size) {
+        throw std::invalid_argument{"too small framer capacity"};
+      }
+    }
+
+    auto version() const noexcept
+      -> std::uint8_t
+    {
+      return version_;
+    }
+
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return size_;
+    }
+
+    auto capacity() const noexcept
+      -> std::size_t
+    {
+      return capacity_;
+    }
+
+    auto error() const noexcept
+      -> framer_error
+    {
+      return error_;
+    }
+
+    // contiguous free space which the next read can be done into directly
+    auto prepare() noexcept
+      -> buffer_range
+    {
+      auto const last = tail();
+      auto const free_last = (last < first_ || size_ == capacity_)
+        ? first_ : capacity_;
+      return buffer_range{buffer_.get() + last, buffer_.get() + free_last};
+    }
+
+    void commit(std::size_t const size) noexcept
+    {
+      size_ += size;
+    }
+
+    auto feed(unsigned char const* first, std::size_t size) noexcept
+      -> std::size_t
+    {
+      auto consumed = std::size_t{0};
+      while (size != 0) {
+        auto const buffer = prepare();
+        auto const copy_size
+          = size < buffer.size() ? size : std::size_t(buffer.size());
+        if (copy_size == 0) {
+          break;
+        }
+        std::memcpy(buffer.begin(), first, copy_size);
+        commit(copy_size);
+        first += copy_size;
+        size -= copy_size;
+        consumed += copy_size;
+      }
+      return consumed;
+    }
+
+    // returns an empty range if no complete message is buffered or the
+    // stream is broken. The returned range is valid until the next call of
+    // a non-const member function.
+    auto next() noexcept
+      -> message_range
+    {
+      if (error_ != framer_error::none || size_ < header_size) {
+        return message_range{};
+      }
+
+      auto const version = at(0);
+      auto const type = at(1);
+      auto const length = std::size_t(at(2)) << 8 | at(3);
+      if (version != version_ && type != hello_type) {
+        error_ = framer_error::bad_version;
+        return message_range{};
+      }
+      if (length < header_size) {
+        error_ = framer_error::bad_length;
+        return message_range{};
+      }
+      if (size_ < length) {
+        return message_range{};
+      }
+
+      auto const first = buffer_.get() + first_;
+      auto const contiguous_size = capacity_ - first_;
+      auto const message = (length <= contiguous_size)
+        ? message_range{first, first + length}
+        : linearize(length, contiguous_size);
+      consume(length);
+      return message;
+    }
+
+  private:
+    static constexpr std::uint8_t hello_type = 0;
+
+    auto tail() const noexcept
+      -> std::size_t
+    {
+      auto const last = first_ + size_;
+      return last >= capacity_ ? last - capacity_ : last;
+    }
+
+    auto at(std::size_t const offset) const noexcept
+      -> unsigned char
+    {
+      auto const pos = first_ + offset;
+      return buffer_[pos >= capacity_ ? pos - capacity_ : pos];
+    }
+
+    auto linearize(
+        std::size_t const length, std::size_t const contiguous_size) noexcept
+      -> message_range
+    {
+      std::memcpy(scratch_.get(), buffer_.get() + first_, contiguous_size);
+      std::memcpy(
+            scratch_.get() + contiguous_size, buffer_.get()
+          , length - contiguous_size);
+      return message_range{scratch_.get(), scratch_.get() + length};
+    }
+
+    void consume(std::size_t const length) noexcept
+    {
+      size_ -= length;
+      if (size_ == 0) {
+        first_ = 0;
+      }
+      else {
+        first_ += length;
+        if (first_ >= capacity_) {
+          first_ -= capacity_;
+        }
+      }
+    }
+
+  private:
+    std::unique_ptr<unsigned char[]> buffer_;
+    std::unique_ptr<unsigned char[]> scratch_;
+    std::size_t capacity_;
+    std::size_t first_;
+    std::size_t size_;
+    std::uint8_t version_;
+    framer_error error_;
+  };
+
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_STREAM_FRAMER_HPP
@@ -0,0 +1,25 @@
+#ifndef CANARD_NET_OFP_TYPE_TRAITS_LIST_INLINE_CAPACITY_HPP
+#define CANARD_NET_OFP_TYPE_TRAITS_LIST_INLINE_CAPACITY_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace type_traits {
+
+  // The number of elements which ofp::list<T> stores without allocation.
+  // It must be specialized before ofp::list<T> is instantiated,
+  // so specializations live next to the declaration of T.
+  template <class T>
+  struct list_inline_capacity
+    : std::integral_constant<std::size_t, 0>
+  {};
+
+} // namespace type_traits
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_TYPE_TRAITS_LIST_INLINE_CAPACITY_HPP
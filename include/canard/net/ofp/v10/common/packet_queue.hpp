@@ -42,7 +42,7 @@ namespace v10 {
 
     packet_queue(packet_queue const&) = default;
 
-    packet_queue(packet_queue&& other)
+    packet_queue(packet_queue&& other) noexcept
       : packet_queue_(other.packet_queue_)
       , properties_(std::move(other).properties_)
     {
@@ -23,6 +23,12 @@ namespace v10 {
     using decode_type_list = default_action_list;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return header.len;
+    }
+
     static_assert(
           std::tuple_size<decode_type_list>::value == 12
         , "not match to the number of action types");
@@ -283,8 +283,8 @@ namespace stats_detail {
     auto extract_body()
       -> body_type
     {
-      auto body = body_type{};
-      body.swap(body_);
+      auto body = std::move(body_);
+      body_.clear();
       stats_.header.length = sizeof(ofp_type);
       return body;
     }
@@ -316,7 +316,7 @@ namespace stats_detail {
 
     array_body_stats(array_body_stats const&) = default;
 
-    array_body_stats(array_body_stats&& other)
+    array_body_stats(array_body_stats&& other) noexcept
       : stats_(other.stats_)
       , body_(other.extract_body())
     {
@@ -53,8 +53,8 @@ namespace flow_mod_detail {
     auto extract_actions()
       -> action_list
     {
-      auto actions = action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       flow_mod_.header.length = sizeof(ofp_type);
       return actions;
     }
@@ -119,7 +119,7 @@ namespace flow_mod_detail {
 
     flow_mod_base(flow_mod_base const& other) = default;
 
-    flow_mod_base(flow_mod_base&& other)
+    flow_mod_base(flow_mod_base&& other) noexcept
       : flow_mod_(other.flow_mod_)
       , actions_(other.extract_actions())
     {
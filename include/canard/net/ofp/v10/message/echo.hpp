@@ -95,8 +95,8 @@ namespace messages {
       auto extract_data() noexcept
         -> data_type
       {
-        auto data = data_type{};
-        data.swap(data_);
+        auto data = std::move(data_);
+        data_.clear();
         header_.length = sizeof(ofp_type);
         return data;
       }
@@ -112,7 +112,7 @@ namespace messages {
       void encode_impl(Container& container) const
       {
         detail::encode(container, header_);
-        detail::encode_byte_array(container, data_.data(), data_.size());
+        detail::encode_payload(container, data_.data(), data_.size());
       }
 
       template <class Iterator>
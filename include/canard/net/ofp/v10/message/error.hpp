@@ -154,8 +154,8 @@ namespace messages {
     auto extract_data() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       error_msg_.header.length = sizeof(ofp_type);
       return data;
     }
@@ -184,7 +184,7 @@ namespace messages {
     void encode_impl(Container& container) const
     {
       detail::encode(container, error_msg_);
-      detail::encode_byte_array(container, data_.data(), data_.size());
+      detail::encode_payload(container, data_.data(), data_.size());
     }
 
     template <class Iterator>
@@ -6,12 +6,14 @@
 #include <cstring>
 #include <iterator>
 #include <utility>
+#include <boost/range/iterator_range.hpp>
 #include <canard/net/ofp/data_type.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/encode.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/v10/detail/basic_message.hpp>
 #include <canard/net/ofp/v10/detail/byteorder.hpp>
+#include <canard/net/ofp/v10/exception.hpp>
 #include <canard/net/ofp/v10/openflow.hpp>
 
 namespace canard {
@@ -20,6 +22,122 @@ namespace ofp {
 namespace v10 {
 namespace messages {
 
+  class packet_in_view
+  {
+    static constexpr std::uint16_t min_pkt_in_len
+      = offsetof(protocol::ofp_packet_in, pad)
+      + sizeof(protocol::ofp_packet_in::pad);
+
+  public:
+    using ofp_type = protocol::ofp_packet_in;
+    using range_type = boost::iterator_range<unsigned char const*>;
+
+    static constexpr protocol::ofp_type message_type
+      = protocol::OFPT_PACKET_IN;
+
+    auto header() const noexcept
+      -> protocol::ofp_header const&
+    {
+      return packet_in_.header;
+    }
+
+    auto length() const noexcept
+      -> std::uint16_t
+    {
+      return packet_in_.header.length;
+    }
+
+    auto xid() const noexcept
+      -> std::uint32_t
+    {
+      return packet_in_.header.xid;
+    }
+
+    auto buffer_id() const noexcept
+      -> std::uint32_t
+    {
+      return packet_in_.buffer_id;
+    }
+
+    auto total_length() const noexcept
+      -> std::uint16_t
+    {
+      return packet_in_.total_len;
+    }
+
+    auto in_port() const noexcept
+      -> std::uint16_t
+    {
+      return packet_in_.in_port;
+    }
+
+    auto reason() const noexcept
+      -> protocol::ofp_packet_in_reason
+    {
+      return protocol::ofp_packet_in_reason(packet_in_.reason);
+    }
+
+    auto frame() const noexcept
+      -> range_type
+    {
+      return range_type{frame_first_, frame_last_};
+    }
+
+    auto frame_length() const noexcept
+      -> std::uint16_t
+    {
+      return frame_last_ - frame_first_;
+    }
+
+    static constexpr auto is_valid_message_length(
+        protocol::ofp_header const& header) noexcept
+      -> bool
+    {
+      return header.length >= min_pkt_in_len;
+    }
+
+    static auto decode(unsigned char const*& first, unsigned char const* last)
+      -> packet_in_view
+    {
+      if (std::distance(first, last) < min_pkt_in_len) {
+        throw v10::exception{
+          protocol::OFPBRC_BAD_LEN, "too small data size for packet_in"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const pkt_in = detail::decode<ofp_type>(
+          first, last, detail::copy_size<min_pkt_in_len>{});
+
+      auto const data_length
+        = std::uint16_t(pkt_in.header.length - min_pkt_in_len);
+      if (!is_valid_message_length(pkt_in.header)
+          || std::distance(first, last) < data_length) {
+        throw v10::exception{
+          protocol::OFPBRC_BAD_LEN, "too small data size for packet_in"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const frame_first = first;
+      first += data_length;
+
+      return packet_in_view{pkt_in, frame_first, first};
+    }
+
+  private:
+    packet_in_view(
+          ofp_type const& pkt_in
+        , unsigned char const* const frame_first
+        , unsigned char const* const frame_last) noexcept
+      : packet_in_(pkt_in)
+      , frame_first_(frame_first)
+      , frame_last_(frame_last)
+    {
+    }
+
+  private:
+    ofp_type packet_in_;
+    unsigned char const* frame_first_;
+    unsigned char const* frame_last_;
+  };
+
   class packet_in
     : public v10_detail::basic_message<packet_in>
   {
@@ -65,6 +183,19 @@ namespace messages {
     {
     }
 
+    explicit packet_in(packet_in_view const& view)
+      : packet_in_{
+            view.header()
+          , view.buffer_id()
+          , view.total_length()
+          , view.in_port()
+          , std::uint8_t(view.reason())
+          , 0
+        }
+      , data_(view.frame().begin(), view.frame().end())
+    {
+    }
+
     packet_in(packet_in const&) = default;
 
     packet_in(packet_in&& other) noexcept
@@ -134,8 +265,8 @@ namespace messages {
     auto extract_frame() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       packet_in_.header.length = min_pkt_in_len;
       return data;
     }
@@ -158,7 +289,7 @@ namespace messages {
     {
       detail::encode(
           container, packet_in_, detail::copy_size<min_pkt_in_len>{});
-      detail::encode_byte_array(container, data_.data(), data_.size());
+      detail::encode_payload(container, data_.data(), data_.size());
     }
 
     template <class Iterator>
@@ -105,7 +105,7 @@ namespace messages {
 
     packet_out(packet_out const&) = default;
 
-    packet_out(packet_out&& other)
+    packet_out(packet_out&& other) noexcept
       : packet_out_(other.packet_out_)
       , actions_(other.extract_actions())
       , data_(std::move(other.data_))
@@ -162,8 +162,8 @@ namespace messages {
     auto extract_actions()
       -> action_list
     {
-      auto actions = action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       packet_out_.header.length -= packet_out_.actions_len;
       packet_out_.actions_len = 0;
       return actions;
@@ -178,8 +178,8 @@ namespace messages {
     auto extract_frame() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       packet_out_.header.length -= data.size();
       return data;
     }
@@ -209,7 +209,7 @@ namespace messages {
     {
       detail::encode(container, packet_out_);
       actions_.encode(container);
-      detail::encode_byte_array(container, data_.data(), data_.size());
+      detail::encode_payload(container, data_.data(), data_.size());
     }
 
     template <class Iterator>
@@ -105,7 +105,7 @@ namespace messages {
 
     queue_get_config_reply(queue_get_config_reply const&) = default;
 
-    queue_get_config_reply(queue_get_config_reply&& other)
+    queue_get_config_reply(queue_get_config_reply&& other) noexcept
       : queue_get_config_reply_(other.queue_get_config_reply_)
       , queues_(other.extract_queues())
     {
@@ -147,8 +147,8 @@ namespace messages {
     auto extract_queues()
       -> queues_type
     {
-      auto queues = queues_type{};
-      queues.swap(queues_);
+      auto queues = std::move(queues_);
+      queues_.clear();
       queue_get_config_reply_.header.length = sizeof(ofp_type);
       return queues;
     }
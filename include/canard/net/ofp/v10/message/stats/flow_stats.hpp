@@ -58,7 +58,7 @@ namespace statistics {
 
     flow_stats(flow_stats const&) = default;
 
-    flow_stats(flow_stats&& other)
+    flow_stats(flow_stats&& other) noexcept
       : flow_stats_(other.flow_stats_)
       , actions_(other.extract_actions())
     {
@@ -123,8 +123,8 @@ namespace statistics {
     auto extract_actions()
       -> action_list
     {
-      auto actions = action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       flow_stats_.length = sizeof(ofp_type);
       return actions;
     }
@@ -111,7 +111,7 @@ namespace messages {
 
     features_reply(features_reply const&) = default;
 
-    features_reply(features_reply&& other)
+    features_reply(features_reply&& other) noexcept
       : switch_features_(other.switch_features_)
       , ports_(other.extract_ports())
     {
@@ -177,8 +177,8 @@ namespace messages {
     auto extract_ports()
       -> ports_type
     {
-      auto tmp = ports_type{};
-      tmp.swap(ports_);
+      auto tmp = std::move(ports_);
+      ports_.clear();
       switch_features_.header.length = sizeof(ofp_type);
       return tmp;
     }
@@ -58,7 +58,7 @@ namespace actions {
     }
 
     auto value() const noexcept
-      -> value_type const&
+      -> value_type
     {
       return field_.oxm_value();
     }
@@ -3,8 +3,11 @@
 
 #include <canard/net/ofp/detail/config.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <canard/net/ofp/detail/any_type.hpp>
+#include <canard/net/ofp/type_traits/list_inline_capacity.hpp>
 #include <canard/net/ofp/v13/action_order.hpp>
 #include <canard/net/ofp/v13/decoder/action_decoder.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -52,6 +55,15 @@ namespace v13 {
   };
 
 } // namespace v13
+
+namespace type_traits {
+
+  template <>
+  struct list_inline_capacity<v13::any_action>
+    : std::integral_constant<std::size_t, 2>
+  {};
+
+} // namespace type_traits
 } // namespace ofp
 } // namespace net
 } // namespace canard
@@ -3,8 +3,11 @@
 
 #include <canard/net/ofp/detail/config.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <canard/net/ofp/detail/any_type.hpp>
+#include <canard/net/ofp/type_traits/list_inline_capacity.hpp>
 #include <canard/net/ofp/v13/decoder/instruction_decoder.hpp>
 #include <canard/net/ofp/v13/instruction_order.hpp>
 
@@ -51,6 +54,15 @@ namespace v13 {
   };
 
 } // namespace v13
+
+namespace type_traits {
+
+  template <>
+  struct list_inline_capacity<v13::any_instruction>
+    : std::integral_constant<std::size_t, 2>
+  {};
+
+} // namespace type_traits
 } // namespace ofp
 } // namespace net
 } // namespace canard
@@ -3,8 +3,11 @@
 
 #include <canard/net/ofp/detail/config.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <canard/net/ofp/detail/any_oxm_match_field_base.hpp>
 #include <canard/net/ofp/detail/any_type.hpp>
+#include <canard/net/ofp/type_traits/list_inline_capacity.hpp>
 #include <canard/net/ofp/v13/decoder/oxm_match_field_decoder.hpp>
 
 namespace canard {
@@ -45,6 +48,15 @@ namespace v13 {
   }
 
 } // namespace v13
+
+namespace type_traits {
+
+  template <>
+  struct list_inline_capacity<v13::any_oxm_match_field>
+    : std::integral_constant<std::size_t, 6>
+  {};
+
+} // namespace type_traits
 } // namespace ofp
 } // namespace net
 } // namespace canard
@@ -10,7 +10,9 @@
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/encode.hpp>
 #include <canard/net/ofp/v13/action_list.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/utility/action_set.hpp>
@@ -81,7 +83,7 @@ namespace v13 {
 
     bucket(bucket const&) = default;
 
-    bucket(bucket&& other)
+    bucket(bucket&& other) noexcept
       : bucket_(other.bucket_)
       , actions_(other.extract_actions())
     {
@@ -135,8 +137,8 @@ namespace v13 {
     auto extract_actions()
       -> action_list
     {
-      auto actions = action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       bucket_.len = sizeof(ofp_type);
       return actions;
     }
@@ -196,29 +198,39 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> bucket
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<bucket>
     {
       auto const bkt = detail::decode<ofp_type>(first, last);
 
       if (bkt.len < sizeof(ofp_type)) {
-        throw exception{
+        return Policy::template error<bucket>(decode_error{
             exception::ex_error_type::bad_bucket
           , exception::ex_error_code::bad_length
           , "too small bucket length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       auto const actions_length = std::uint16_t(bkt.len - sizeof(ofp_type));
       if (std::distance(first, last) < actions_length) {
-        throw exception{
+        return Policy::template error<bucket>(decode_error{
           protocol::bad_request_code::bad_len, "too small data size for bucket"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       last = std::next(first, actions_length);
 
-      auto actions = action_list::decode(first, last);
+      auto actions = action_list::decode(first, last, policy);
+      if (Policy::failed(actions)) {
+        return Policy::template error<bucket>(Policy::error_of(actions));
+      }
 
-      return bucket{bkt, std::move(actions)};
+      return bucket{bkt, std::move(Policy::value_of(actions))};
     }
 
     auto equal_impl(bucket const& rhs) const noexcept
@@ -5,11 +5,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <algorithm>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <boost/assert.hpp>
+#include <boost/optional/optional.hpp>
 #include <canard/net/ofp/detail/basic_protocol_type.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/encode.hpp>
@@ -17,7 +20,10 @@
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/type_traits/is_all_constructible.hpp>
 #include <canard/net/ofp/v13/any_oxm_match_field.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/oxm_field_index.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/utility/oxm_match_field_set.hpp>
@@ -37,6 +43,14 @@ namespace v13 {
     using oxm_fields_type = ofp::list<any_oxm_match_field>;
 
   private:
+    using index_type = detail::v13::oxm_field_index;
+
+    template <class OXMMatchField>
+    using enable_if_is_basic_field_t = typename std::enable_if<
+         OXMMatchField::oxm_class() == protocol::OFPXMC_OPENFLOW_BASIC
+      && OXMMatchField::oxm_field() < index_type::num_fields
+    >::type;
+
     template <class... Ts>
     using enable_if_is_all_constructible_t = typename std::enable_if<
          sizeof...(Ts)
@@ -60,6 +74,7 @@ namespace v13 {
           , oxm_fields.calc_ofp_length(base_size)
           , { 0, 0, 0, 0 }
         }
+      , index_(oxm_fields)
       , oxm_fields_(std::move(oxm_fields))
     {
     }
@@ -75,8 +90,9 @@ namespace v13 {
 
     oxm_match(oxm_match const&) = default;
 
-    oxm_match(oxm_match&& other)
+    oxm_match(oxm_match&& other) noexcept
       : match_(other.match_)
+      , index_(other.index_)
       , oxm_fields_(other.extract_oxm_fields())
     {
     }
@@ -95,9 +111,10 @@ namespace v13 {
       return *this;
     }
 
-    void swap(oxm_match& other) noexcept
+    void swap(oxm_match& other)
     {
       std::swap(match_, other.match_);
+      std::swap(index_, other.index_);
       oxm_fields_.swap(other.oxm_fields_);
     }
 
@@ -122,12 +139,63 @@ namespace v13 {
     auto extract_oxm_fields()
       -> oxm_fields_type
     {
-      auto oxm_fields = oxm_fields_type{};
-      oxm_fields.swap(oxm_fields_);
+      auto oxm_fields = std::move(oxm_fields_);
+      oxm_fields_.clear();
       match_.length = base_size;
+      index_ = index_type{};
       return oxm_fields;
     }
 
+    template <
+        class OXMMatchField, class = enable_if_is_basic_field_t<OXMMatchField>
+    >
+    auto contains() const noexcept
+      -> bool
+    {
+      return index_.contains(index_type::bits<OXMMatchField>());
+    }
+
+    template <
+        class... OXMMatchFields
+      , class = typename std::enable_if<sizeof...(OXMMatchFields)>::type
+    >
+    auto contains_all() const noexcept
+      -> bool
+    {
+      return index_.contains(index_type::bits<OXMMatchFields...>());
+    }
+
+    template <
+        class OXMMatchField, class = enable_if_is_basic_field_t<OXMMatchField>
+    >
+    auto get() const
+      -> OXMMatchField const&
+    {
+      BOOST_ASSERT(contains<OXMMatchField>());
+      auto const position = index_.position(OXMMatchField::oxm_field());
+      if (position != index_type::npos) {
+        return v13::any_cast<OXMMatchField>(oxm_fields_[position]);
+      }
+      return v13::any_cast<OXMMatchField>(*std::find_if(
+            oxm_fields_.begin(), oxm_fields_.end()
+          , [](any_oxm_match_field const& field) {
+              return field.oxm_class() == OXMMatchField::oxm_class()
+                  && field.oxm_field() == OXMMatchField::oxm_field();
+            }));
+    }
+
+    template <
+        class OXMMatchField, class = enable_if_is_basic_field_t<OXMMatchField>
+    >
+    auto find() const
+      -> boost::optional<OXMMatchField const&>
+    {
+      if (!contains<OXMMatchField>()) {
+        return boost::none;
+      }
+      return get<OXMMatchField>();
+    }
+
     auto calc_ofp_length(std::uint16_t const base_length) const
       -> std::uint16_t
     {
@@ -140,21 +208,33 @@ namespace v13 {
 
     static void validate_header(protocol::ofp_match const& match)
     {
-      if (match.type != match_type) {
+      if (auto const error = try_validate_header(match)) {
         throw exception{
-          protocol::bad_match_code::bad_type, "invalid match type"
+          error.error_type(), error.error_code(), error.what()
         } << CANARD_NET_OFP_ERROR_INFO();
       }
+    }
+
+    static auto try_validate_header(protocol::ofp_match const& match) noexcept
+      -> decode_error
+    {
+      if (match.type != match_type) {
+        return decode_error{
+          protocol::bad_match_code::bad_type, "invalid match type"
+        };
+      }
       if (match.length < base_size) {
-        throw exception{
+        return decode_error{
           protocol::bad_match_code::bad_len, "too small match length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        };
       }
+      return decode_error{};
     }
 
   private:
     oxm_match(ofp_type const& match, oxm_fields_type&& oxm_fields)
       : match_(match)
+      , index_(oxm_fields)
       , oxm_fields_(std::move(oxm_fields))
     {
     }
@@ -188,12 +268,22 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> oxm_match
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<oxm_match>
     {
       auto const match = detail::decode<ofp_type>(
           first, last, detail::copy_size<base_size>{});
       last = std::next(first, match.length - base_size);
-      auto oxm_fields = oxm_fields_type::decode(first, last);
-      return oxm_match{match, std::move(oxm_fields)};
+      auto oxm_fields = oxm_fields_type::decode(first, last, policy);
+      if (Policy::failed(oxm_fields)) {
+        return Policy::template error<oxm_match>(Policy::error_of(oxm_fields));
+      }
+      return oxm_match{match, std::move(Policy::value_of(oxm_fields))};
     }
 
     auto equal_impl(oxm_match const& rhs) const noexcept
@@ -212,6 +302,7 @@ namespace v13 {
 
   private:
     ofp_type match_;
+    index_type index_;
     oxm_fields_type oxm_fields_;
   };
 
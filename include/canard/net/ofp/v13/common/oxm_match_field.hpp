@@ -35,6 +35,10 @@ namespace oxm_match_fields {
       static auto to_oxm_value(value_type const& v) noexcept
         -> oxm_value_type
       { return v; }
+
+      static auto from_oxm_value(oxm_value_type const& v) noexcept
+        -> value_type
+      { return v; }
     };
 
     struct mac_address_type
@@ -47,6 +51,10 @@ namespace oxm_match_fields {
       static auto to_oxm_value(value_type const& v) noexcept
         -> oxm_value_type
       { return v.to_bytes(); }
+
+      static auto from_oxm_value(oxm_value_type const& v) noexcept
+        -> value_type
+      { return value_type{v}; }
     };
 
     struct address_v4_type
@@ -59,6 +67,10 @@ namespace oxm_match_fields {
       static auto to_oxm_value(value_type const& v) noexcept
         -> oxm_value_type
       { return v.to_bytes(); }
+
+      static auto from_oxm_value(oxm_value_type const& v) noexcept
+        -> value_type
+      { return value_type{v}; }
     };
 
     struct address_v6_type
@@ -71,6 +83,10 @@ namespace oxm_match_fields {
       static auto to_oxm_value(value_type const& v) noexcept
         -> oxm_value_type
       { return v.to_bytes(); }
+
+      static auto from_oxm_value(oxm_value_type const& v) noexcept
+        -> value_type
+      { return value_type{v}; }
     };
 
     template <protocol::ofp_oxm_class OXMClass, std::uint8_t OXMField>
@@ -328,17 +344,18 @@ namespace oxm_match_fields {
     friend base_t;
 
     using oxm_value_type = typename base_t::oxm_value_type;
+    using raw_value_tag = typename base_t::raw_value_tag;
 
     static constexpr protocol::ofp_oxm_class oxm_class_value = OXMClass;
     static constexpr std::uint8_t oxm_field_value = OXMField;
 
     explicit oxm_match_field(oxm_value_type const& value)
-      : base_t{value_type{value}}
+      : base_t{raw_value_tag{}, value}
     {
     }
 
     oxm_match_field(oxm_value_type const& value, oxm_value_type const& mask)
-      : base_t{value_type{value}, value_type{mask}}
+      : base_t{raw_value_tag{}, value, mask}
     {
     }
 
@@ -393,17 +410,18 @@ namespace oxm_match_fields {
     friend base_t;
 
     using oxm_value_type = typename base_t::oxm_value_type;
+    using raw_value_tag = typename base_t::raw_value_tag;
 
     static constexpr protocol::ofp_oxm_class oxm_class_value = OXMClass;
     static constexpr std::uint8_t oxm_field_value = OXMField;
 
-    explicit oxm_match_field(oxm_value_type const value)
-      : base_t{value_type{value}}
+    explicit oxm_match_field(oxm_value_type const& value)
+      : base_t{raw_value_tag{}, value}
     {
     }
 
-    oxm_match_field(oxm_value_type const value, oxm_value_type const mask)
-      : base_t{value_type{value}, value_type{mask}}
+    oxm_match_field(oxm_value_type const& value, oxm_value_type const& mask)
+      : base_t{raw_value_tag{}, value, mask}
     {
     }
 
@@ -466,17 +484,18 @@ namespace oxm_match_fields {
     friend base_t;
 
     using oxm_value_type = typename base_t::oxm_value_type;
+    using raw_value_tag = typename base_t::raw_value_tag;
 
     static constexpr protocol::ofp_oxm_class oxm_class_value = OXMClass;
     static constexpr std::uint8_t oxm_field_value = OXMField;
 
-    explicit oxm_match_field(oxm_value_type const value)
-      : base_t{value_type{value}}
+    explicit oxm_match_field(oxm_value_type const& value)
+      : base_t{raw_value_tag{}, value}
     {
     }
 
-    oxm_match_field(oxm_value_type const value, oxm_value_type const mask)
-      : base_t{value_type{value}, value_type{mask}}
+    oxm_match_field(oxm_value_type const& value, oxm_value_type const& mask)
+      : base_t{raw_value_tag{}, value, mask}
     {
     }
 
@@ -0,0 +1,276 @@
+#ifndef CANARD_NET_OFP_V13_OXM_MATCH_VIEW_HPP
+#define CANARD_NET_OFP_V13_OXM_MATCH_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <boost/optional/optional.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/v13/common/oxm_header.hpp>
+#include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/length_utility.hpp>
+#include <canard/net/ofp/v13/exception.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  class oxm_match_view
+  {
+    static constexpr std::uint16_t base_size
+      = offsetof(protocol::ofp_match, pad);
+
+  public:
+    using range_type = boost::iterator_range<unsigned char const*>;
+
+    class raw_field
+    {
+    public:
+      raw_field(v13::oxm_header const header, range_type const& value) noexcept
+        : header_(header), value_(value)
+      {
+      }
+
+      auto header() const noexcept
+        -> v13::oxm_header
+      {
+        return header_;
+      }
+
+      auto value() const noexcept
+        -> range_type
+      {
+        return value_;
+      }
+
+    private:
+      v13::oxm_header header_;
+      range_type value_;
+    };
+
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = raw_field;
+      using difference_type = std::ptrdiff_t;
+      using pointer = raw_field const*;
+      using reference = raw_field;
+
+      const_iterator() noexcept
+        : first_(nullptr), last_(nullptr)
+      {
+      }
+
+      const_iterator(
+            unsigned char const* const first
+          , unsigned char const* const last) noexcept
+        : first_(first), last_(last)
+      {
+        normalize();
+      }
+
+      auto operator*() const noexcept
+        -> reference
+      {
+        auto const header = current_header();
+        auto const value_first = first_ + sizeof(std::uint32_t);
+        return raw_field{
+          header, range_type{value_first, value_first + header.oxm_length()}
+        };
+      }
+
+      auto operator++() noexcept
+        -> const_iterator&
+      {
+        first_ += field_length();
+        normalize();
+        return *this;
+      }
+
+      auto operator++(int) noexcept
+        -> const_iterator
+      {
+        auto it = *this;
+        ++*this;
+        return it;
+      }
+
+      friend auto operator==(
+          const_iterator const& lhs, const_iterator const& rhs) noexcept
+        -> bool
+      {
+        return lhs.first_ == rhs.first_;
+      }
+
+      friend auto operator!=(
+          const_iterator const& lhs, const_iterator const& rhs) noexcept
+        -> bool
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+      auto current_header() const noexcept
+        -> v13::oxm_header
+      {
+        auto it = first_;
+        return v13::oxm_header{detail::decode<std::uint32_t>(it, last_)};
+      }
+
+      auto field_length() const noexcept
+        -> std::size_t
+      {
+        return sizeof(std::uint32_t) + current_header().oxm_length();
+      }
+
+      // a truncated trailing field terminates the iteration
+      void normalize() noexcept
+      {
+        if (std::size_t(last_ - first_) < sizeof(std::uint32_t)
+            || std::size_t(last_ - first_) < field_length()) {
+          first_ = last_;
+        }
+      }
+
+      unsigned char const* first_;
+      unsigned char const* last_;
+    };
+
+    using iterator = const_iterator;
+
+    oxm_match_view() noexcept
+      : first_(nullptr), length_(0)
+    {
+    }
+
+    auto length() const noexcept
+      -> std::uint16_t
+    {
+      return length_;
+    }
+
+    auto byte_length() const noexcept
+      -> std::uint16_t
+    {
+      return detail::v13::exact_length(length_);
+    }
+
+    auto data() const noexcept
+      -> range_type
+    {
+      return range_type{first_, first_ + length_};
+    }
+
+    auto begin() const noexcept
+      -> const_iterator
+    {
+      if (length_ < base_size) {
+        return end();
+      }
+      return const_iterator{first_ + base_size, first_ + length_};
+    }
+
+    auto end() const noexcept
+      -> const_iterator
+    {
+      return const_iterator{first_ + length_, first_ + length_};
+    }
+
+    auto empty() const noexcept
+      -> bool
+    {
+      return begin() == end();
+    }
+
+    template <class OXMMatchField>
+    auto contains() const noexcept
+      -> bool
+    {
+      return find_raw(OXMMatchField::oxm_type()) != end();
+    }
+
+    template <class OXMMatchField>
+    auto find() const
+      -> boost::optional<OXMMatchField>
+    {
+      auto const it = find_raw(OXMMatchField::oxm_type());
+      if (it == end()) {
+        return boost::none;
+      }
+      auto const field = *it;
+      if (auto const error_msg
+          = OXMMatchField::validate_header(field.header())) {
+        throw exception{protocol::bad_match_code::bad_len, error_msg}
+          << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto first = field.value().begin() - sizeof(std::uint32_t);
+      return OXMMatchField::decode(first, field.value().end());
+    }
+
+    auto to_oxm_match() const
+      -> oxm_match
+    {
+      auto it = first_;
+      return oxm_match::decode(it, first_ + byte_length());
+    }
+
+    static auto decode(unsigned char const*& first, unsigned char const* last)
+      -> oxm_match_view
+    {
+      if (std::size_t(std::distance(first, last)) < base_size) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for oxm_match"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const match = detail::decode_without_consumption<protocol::ofp_match>(
+          first, last, detail::copy_size<base_size>{});
+      oxm_match::validate_header(match);
+      auto const byte_length = detail::v13::exact_length(match.length);
+      if (std::distance(first, last) < byte_length) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for oxm_match"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const view = oxm_match_view{first, match.length};
+      first += byte_length;
+      return view;
+    }
+
+  private:
+    oxm_match_view(
+        unsigned char const* const first, std::uint16_t const length) noexcept
+      : first_(first), length_(length)
+    {
+    }
+
+    auto find_raw(std::uint32_t const oxm_type) const noexcept
+      -> const_iterator
+    {
+      auto it = begin();
+      auto const last = end();
+      for (; it != last; ++it) {
+        if ((*it).header().oxm_type() == oxm_type) {
+          break;
+        }
+      }
+      return it;
+    }
+
+  private:
+    unsigned char const* first_;
+    std::uint16_t length_;
+  };
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_OXM_MATCH_VIEW_HPP
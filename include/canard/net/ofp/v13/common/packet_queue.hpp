@@ -12,7 +12,9 @@
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/queue_id.hpp>
 #include <canard/net/ofp/v13/any_queue_property.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -49,7 +51,7 @@ namespace v13 {
 
     packet_queue(packet_queue const&) = default;
 
-    packet_queue(packet_queue&& other)
+    packet_queue(packet_queue&& other) noexcept
       : packet_queue_(other.packet_queue_)
         , properties_(other.extract_properties())
     {
@@ -97,8 +99,8 @@ namespace v13 {
     auto extract_properties()
       -> properties_type
     {
-      auto properties = properties_type{};
-      properties.swap(properties_);
+      auto properties = std::move(properties_);
+      properties_.clear();
       packet_queue_.len = sizeof(ofp_type);
       return properties;
     }
@@ -122,29 +124,40 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> packet_queue
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<packet_queue>
     {
       auto const pkt_queue = detail::decode<ofp_type>(first, last);
       if (pkt_queue.len < sizeof(ofp_type)) {
-        throw exception{
+        return Policy::template error<packet_queue>(decode_error{
             exception::ex_error_type::bad_packet_queue
           , exception::ex_error_code::bad_length
           , "too small packet_queue length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       auto const properties_length
         = std::uint16_t(pkt_queue.len - sizeof(ofp_type));
       if (std::distance(first, last) < properties_length) {
-        throw exception{
+        return Policy::template error<packet_queue>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for packet_queue"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, properties_length);
 
-      auto properties = properties_type::decode(first, last);
+      auto properties = properties_type::decode(first, last, policy);
+      if (Policy::failed(properties)) {
+        return Policy::template error<packet_queue>(
+            Policy::error_of(properties));
+      }
 
-      return packet_queue{pkt_queue, std::move(properties)};
+      return packet_queue{pkt_queue, std::move(Policy::value_of(properties))};
     }
 
     auto equal_impl(packet_queue const& rhs) const noexcept
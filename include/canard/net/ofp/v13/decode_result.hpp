@@ -0,0 +1,160 @@
+#ifndef CANARD_NET_OFP_V13_DECODE_RESULT_HPP
+#define CANARD_NET_OFP_V13_DECODE_RESULT_HPP
+
+#include <cstdint>
+#include <utility>
+#include <boost/optional/optional.hpp>
+#include <canard/net/ofp/v13/error_code.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  class decode_error
+  {
+  public:
+    constexpr decode_error() noexcept
+      : error_type_(0), error_code_(0), what_(nullptr)
+    {
+    }
+
+    constexpr decode_error(
+          std::uint32_t const error_type
+        , std::uint16_t const error_code
+        , char const* const what) noexcept
+      : error_type_(error_type), error_code_(error_code), what_(what)
+    {
+    }
+
+    template <class ErrorCode>
+    constexpr decode_error(
+        ErrorCode const error_code, char const* const what) noexcept
+      : error_type_(v13::error_code<ErrorCode>::error_type)
+      , error_code_(std::uint16_t(error_code))
+      , what_(what)
+    {
+    }
+
+    constexpr auto error_type() const noexcept
+      -> std::uint32_t
+    {
+      return error_type_;
+    }
+
+    constexpr auto error_code() const noexcept
+      -> std::uint16_t
+    {
+      return error_code_;
+    }
+
+    constexpr auto what() const noexcept
+      -> char const*
+    {
+      return what_ ? what_ : "";
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+      return what_ != nullptr;
+    }
+
+  private:
+    std::uint32_t error_type_;
+    std::uint16_t error_code_;
+    char const* what_;
+  };
+
+
+  template <class T>
+  class decode_result
+  {
+  public:
+    using value_type = T;
+
+    decode_result(T const& value)
+      : value_(value)
+    {
+    }
+
+    decode_result(T&& value)
+      : value_(std::move(value))
+    {
+    }
+
+    decode_result(decode_error const& error) noexcept
+      : error_(error)
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+      return bool(value_);
+    }
+
+    auto value() &
+      -> T&
+    {
+      return *value_;
+    }
+
+    auto value() const&
+      -> T const&
+    {
+      return *value_;
+    }
+
+    auto value() &&
+      -> T&&
+    {
+      return std::move(*value_);
+    }
+
+    auto error() const noexcept
+      -> decode_error const&
+    {
+      return error_;
+    }
+
+  private:
+    boost::optional<T> value_;
+    decode_error error_;
+  };
+
+  template <>
+  class decode_result<void>
+  {
+  public:
+    using value_type = void;
+
+    decode_result() noexcept
+      : error_{}
+    {
+    }
+
+    decode_result(decode_error const& error) noexcept
+      : error_(error)
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+      return !error_;
+    }
+
+    auto error() const noexcept
+      -> decode_error const&
+    {
+      return error_;
+    }
+
+  private:
+    decode_error error_;
+  };
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_DECODE_RESULT_HPP
@@ -4,11 +4,13 @@
 #include <cstdint>
 #include <iterator>
 #include <tuple>
-#include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/v13/actions.hpp>
 #include <canard/net/ofp/v13/decoder/set_field_decoder.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/decode_table.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -17,72 +19,112 @@ namespace net {
 namespace ofp {
 namespace v13 {
 
-  struct action_decoder
+  template <class ActionList, class SetFieldList>
+  struct basic_action_decoder
   {
     using header_type = protocol::ofp_action_header;
     using type_id = std::uint16_t;
-    using decode_type_list = default_all_action_list;
-    using non_set_field_action_type_list = default_action_list;
+    using decode_type_list
+      = typename actions_detail::tuple_cat<ActionList, SetFieldList>::type;
+    using non_set_field_action_type_list = ActionList;
+    using set_field_decoder = basic_set_field_decoder<SetFieldList>;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
-    static_assert(
-          std::tuple_size<non_set_field_action_type_list>::value == 15
-        , "not match to the number of action types");
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return header.len;
+    }
 
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const action_header
         = detail::decode_without_consumption<header_type>(first, last);
 
       if (std::distance(first, last) < action_header.len) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
           protocol::bad_request_code::bad_len, "too small data size for action"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
-      switch (action_header.type) {
+      if (action_header.type == protocol::OFPAT_SET_FIELD) {
+        if (action_header.len < set_field_decoder::header_size) {
+          return Policy::template error<ReturnType>(decode_error{
+            protocol::bad_action_code::bad_len, "invalid action length"
+          });
+        }
+        return set_field_decoder::template decode_impl<ReturnType, Policy>(
+            first, last, function);
+      }
 
-#     define CANARD_NET_OFP_V13_ACTION_CASE(z, N, _) \
-      using action ## N \
-        = std::tuple_element<N, non_set_field_action_type_list>::type; \
-      case action ## N::type(): \
-        if (!action ## N::is_valid_action_length(action_header)) { \
-          throw exception{ \
-            protocol::bad_action_code::bad_len, "invalid action length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
-        } \
-        return function(action ## N::decode(first, last));
+      return action_table::template dispatch<
+        basic_action_decoder, ReturnType, Policy
+      >(action_header.type, action_header, first, last, function);
+    }
 
-      BOOST_PP_REPEAT(15, CANARD_NET_OFP_V13_ACTION_CASE, _)
+  private:
+    using action_table = detail::v13::decode_table<
+      detail::v13::type_key, ActionList
+    >;
 
-#     undef CANARD_NET_OFP_V13_ACTION_CASE
+    template <class, class>
+    friend class detail::v13::decode_table;
 
-      case protocol::OFPAT_SET_FIELD:
-        if (action_header.len < set_field_decoder::header_size) {
-          throw exception{
-            protocol::bad_action_code::bad_len, "invalid action length"
-          } << CANARD_NET_OFP_ERROR_INFO();
-        }
-        return set_field_decoder::decode<ReturnType>(
-            first, last, std::move(function));
-      default:
-        throw exception{
-          protocol::bad_action_code::bad_type, "unknown action"
-        } << CANARD_NET_OFP_ERROR_INFO();
+    template <
+        class T, class ReturnType, class Policy, class Iterator, class Function
+    >
+    static auto decode_type(
+          header_type const& action_header
+        , Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      if (!T::is_valid_action_length(action_header)) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_action_code::bad_len, "invalid action length"
+        });
       }
+      return Policy::template decode<ReturnType, T>(first, last, function);
     }
 
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto unknown_type(header_type const&, Iterator&, Iterator, Function&)
+      -> typename Policy::template result_type<ReturnType>
     {
-      return decode<ReturnType>(first, last, function);
+      return Policy::template error<ReturnType>(decode_error{
+        protocol::bad_action_code::bad_type, "unknown action"
+      });
     }
   };
 
+  using action_decoder
+    = basic_action_decoder<default_action_list, default_set_field_list>;
+
 } // namespace v13
 } // namespace ofp
 } // namespace net
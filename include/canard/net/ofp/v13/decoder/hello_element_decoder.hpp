@@ -6,7 +6,10 @@
 #include <tuple>
 #include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/hello_elements.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -48,18 +51,48 @@ namespace v13 {
     >;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return detail::v13::exact_length(header.length);
+    }
+
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const helem_header
         = detail::decode_without_consumption<header_type>(first, last);
 
       if (std::distance(first, last) < helem_header.length) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for hello_element"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       switch (helem_header.type) {
@@ -68,30 +101,24 @@ namespace v13 {
       using helem ## N = std::tuple_element<N, hello_element_list>::type; \
       case helem ## N::type(): \
         if (!helem ## N::is_valid_hello_element_length(helem_header)) { \
-          throw exception{ \
+          return Policy::template error<ReturnType>(decode_error{ \
               exception::ex_error_type::bad_hello_element \
             , exception::ex_error_code::bad_length \
             , "invalid hello_element length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
+          }); \
         } \
-        return function(helem ## N::decode(first, last));
+        return Policy::template decode<ReturnType, helem ## N>( \
+            first, last, function);
 
       BOOST_PP_REPEAT(1, CANARD_NET_OFP_V13_HELLO_ELEMENT_DECODE_CASE, _)
 
 #     undef CANARD_NET_OFP_V13_HELLO_ELEMENT_DECODE_CASE
 
       default:
-        return function(unknwon_type::decode(first, last));
+        return Policy::template decode<ReturnType, unknwon_type>(
+            first, last, function);
       }
     }
-
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
-    {
-      return decode<ReturnType>(first, last, function);
-    }
   };
 
 } // namespace v13
@@ -6,7 +6,9 @@
 #include <tuple>
 #include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/instructions.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -23,6 +25,12 @@ namespace v13 {
     using decode_type_list = default_instruction_list;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return header.len;
+    }
+
     static_assert(
           std::tuple_size<decode_type_list>::value == 6
         , "not match to the number of instruction types");
@@ -30,15 +38,39 @@ namespace v13 {
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const instruction
         = detail::decode_without_consumption<header_type>(first, last);
 
       if (std::distance(first, last) < instruction.len) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for instruction"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       switch (instruction.type) {
@@ -47,31 +79,24 @@ namespace v13 {
       using instruction ## N = std::tuple_element<N, decode_type_list>::type; \
       case instruction ## N::type(): \
         if (!instruction ## N::is_valid_instruction_length(instruction)) { \
-          throw exception{ \
+          return Policy::template error<ReturnType>(decode_error{ \
               protocol::bad_instruction_code::bad_len \
             , "invalid instruction length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
+          }); \
         } \
-        return function(instruction ## N::decode(first, last));
+        return Policy::template decode<ReturnType, instruction ## N>( \
+            first, last, function);
 
       BOOST_PP_REPEAT(6, CANARD_NET_OFP_V13_INSTRUCTION_CASE, _)
 
 #     undef CANARD_NET_OFP_V13_INSTRUCTION_CASE
 
       default:
-          throw exception{
+          return Policy::template error<ReturnType>(decode_error{
             protocol::bad_instruction_code::unknown_inst, "unknown instruction"
-          } << CANARD_NET_OFP_ERROR_INFO();
+          });
       }
     }
-
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
-    {
-      return decode<ReturnType>(first, last, function);
-    }
   };
 
 } // namespace v13
@@ -0,0 +1,428 @@
+#ifndef CANARD_NET_OFP_V13_MESSAGE_DECODER_HPP
+#define CANARD_NET_OFP_V13_MESSAGE_DECODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
+#include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/decode_table.hpp>
+#include <canard/net/ofp/v13/exception.hpp>
+#include <canard/net/ofp/v13/messages.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  namespace message_decoder_detail {
+
+    struct message_type_key
+    {
+      template <class T>
+      static constexpr auto key() noexcept
+        -> std::size_t
+      {
+        return T::message_type;
+      }
+    };
+
+    struct multipart_type_key
+    {
+      template <class T>
+      static constexpr auto key() noexcept
+        -> std::size_t
+      {
+        return T::multipart_type_value;
+      }
+    };
+
+    template <class KeyOf>
+    constexpr auto index_of(std::size_t, std::size_t const i) noexcept
+      -> std::size_t
+    {
+      return i;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto index_of(std::size_t const key, std::size_t const i) noexcept
+      -> std::size_t
+    {
+      return KeyOf::template key<T>() == key
+        ? i : message_decoder_detail::index_of<KeyOf, Ts...>(key, i + 1);
+    }
+
+    template <class KeyOf>
+    constexpr auto max_key() noexcept
+      -> std::size_t
+    {
+      return 0;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto max_key() noexcept
+      -> std::size_t
+    {
+      return KeyOf::template key<T>() > max_key<KeyOf, Ts...>()
+        ? KeyOf::template key<T>() : max_key<KeyOf, Ts...>();
+    }
+
+    template <class KeyOf, class TypeList>
+    struct key_table;
+
+    template <class KeyOf, class... Ts>
+    struct key_table<KeyOf, std::tuple<Ts...>>
+    {
+      static constexpr std::size_t size = sizeof...(Ts);
+      static constexpr std::size_t table_size
+        = size ? message_decoder_detail::max_key<KeyOf, Ts...>() + 1 : 0;
+
+      static constexpr auto index_of(std::size_t const key) noexcept
+        -> std::size_t
+      {
+        return message_decoder_detail::index_of<KeyOf, Ts...>(key, 0);
+      }
+    };
+
+    template <class MultipartList>
+    struct multipart_header
+    {
+      using type = typename std::conditional<
+          std::tuple_element<0, MultipartList>::type::message_type
+            == protocol::OFPT_MULTIPART_REQUEST
+        , protocol::ofp_multipart_request
+        , protocol::ofp_multipart_reply
+      >::type;
+      static constexpr std::size_t message_type
+        = std::tuple_element<0, MultipartList>::type::message_type;
+    };
+
+    template <>
+    struct multipart_header<std::tuple<>>
+    {
+      using type = protocol::ofp_multipart_reply;
+      static constexpr std::size_t message_type = std::size_t(-1);
+    };
+
+  } // namespace message_decoder_detail
+
+
+  template <class MessageList, class MultipartList>
+  struct basic_message_decoder
+  {
+    using header_type = protocol::ofp_header;
+    using type_id = std::uint8_t;
+    using decode_type_list = MessageList;
+    using multipart_type_list = MultipartList;
+    using multipart_header_type
+      = typename message_decoder_detail::multipart_header<MultipartList>::type;
+    static constexpr std::uint16_t header_size = sizeof(header_type);
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode(Iterator& first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      if (std::distance(first, last) < header_size) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "too small data size for header"
+        });
+      }
+
+      auto const header
+        = detail::decode_without_consumption<header_type>(first, last);
+
+      if (header.version != protocol::OFP_VERSION) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_version, "unsupported version"
+        });
+      }
+      if (header.length < header_size) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "too small message length"
+        });
+      }
+      if (std::distance(first, last) < header.length) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "too small data size for message"
+        });
+      }
+      last = std::next(first, header.length);
+
+      using table = message_table<ReturnType, Policy, Iterator, Function>;
+      if (header.type >= table::size) {
+        return unknown_message<ReturnType, Policy>(first, last, function);
+      }
+      return table::dispatch(header.type, first, last, function);
+    }
+
+  private:
+    using message_keys = message_decoder_detail::key_table<
+      message_decoder_detail::message_type_key, MessageList
+    >;
+    using multipart_keys = message_decoder_detail::key_table<
+      message_decoder_detail::multipart_type_key, MultipartList
+    >;
+    static constexpr std::size_t multipart_message_type
+      = message_decoder_detail::multipart_header<MultipartList>::message_type;
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    using decode_function
+      = typename Policy::template result_type<ReturnType>(*)(
+          Iterator&, Iterator, Function&);
+
+    template <
+        class T, class ReturnType, class Policy, class Iterator, class Function
+    >
+    static auto decode_message(
+        Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      auto const header
+        = detail::decode_without_consumption<header_type>(first, last);
+      if (!T::is_valid_message_length(header)) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "invalid message length"
+        });
+      }
+      return Policy::template decode<ReturnType, T>(first, last, function);
+    }
+
+    template <
+        class T, class ReturnType, class Policy, class Iterator, class Function
+    >
+    static auto decode_multipart_message(
+        Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      auto const multipart
+        = detail::decode_without_consumption<multipart_header_type>(
+            first, last);
+      if (!T::is_valid_multipart_length(multipart)) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "invalid multipart length"
+        });
+      }
+      return Policy::template decode<ReturnType, T>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto unknown_message(Iterator&, Iterator, Function&)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      return Policy::template error<ReturnType>(decode_error{
+        protocol::bad_request_code::bad_type, "unknown message type"
+      });
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto unknown_multipart(Iterator&, Iterator, Function&)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      return Policy::template error<ReturnType>(decode_error{
+        protocol::bad_request_code::bad_multipart, "unknown multipart type"
+      });
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto dispatch_multipart(
+        Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      if (std::size_t(std::distance(first, last))
+          < sizeof(multipart_header_type)) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_request_code::bad_len, "too small multipart length"
+        });
+      }
+      auto const multipart
+        = detail::decode_without_consumption<multipart_header_type>(
+            first, last);
+
+      using table = multipart_table<ReturnType, Policy, Iterator, Function>;
+      if (multipart.type >= table::size) {
+        return unknown_multipart<ReturnType, Policy>(first, last, function);
+      }
+      return table::dispatch(multipart.type, first, last, function);
+    }
+
+    template <
+        std::size_t Key
+      , class ReturnType, class Policy, class Iterator, class Function
+      , std::size_t Index = message_keys::index_of(Key)
+    >
+    static constexpr auto message_entry(std::true_type) noexcept
+      -> decode_function<ReturnType, Policy, Iterator, Function>
+    {
+      return &decode_message<
+          typename std::tuple_element<Index, MessageList>::type
+        , ReturnType, Policy, Iterator, Function
+      >;
+    }
+
+    template <
+        std::size_t Key
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    static constexpr auto message_entry(std::false_type) noexcept
+      -> decode_function<ReturnType, Policy, Iterator, Function>
+    {
+      return Key == multipart_message_type
+        ? &dispatch_multipart<ReturnType, Policy, Iterator, Function>
+        : &unknown_message<ReturnType, Policy, Iterator, Function>;
+    }
+
+    template <
+        std::size_t Key
+      , class ReturnType, class Policy, class Iterator, class Function
+      , std::size_t Index = multipart_keys::index_of(Key)
+    >
+    static constexpr auto multipart_entry(std::true_type) noexcept
+      -> decode_function<ReturnType, Policy, Iterator, Function>
+    {
+      return &decode_multipart_message<
+          typename std::tuple_element<Index, MultipartList>::type
+        , ReturnType, Policy, Iterator, Function
+      >;
+    }
+
+    template <
+        std::size_t Key
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    static constexpr auto multipart_entry(std::false_type) noexcept
+      -> decode_function<ReturnType, Policy, Iterator, Function>
+    {
+      return &unknown_multipart<ReturnType, Policy, Iterator, Function>;
+    }
+
+    template <
+        class Sequence
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    struct basic_message_table;
+
+    template <
+        std::size_t... Keys
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    struct basic_message_table<
+        detail::v13::index_sequence<Keys...>
+      , ReturnType, Policy, Iterator, Function
+    >
+    {
+      static constexpr std::size_t size = sizeof...(Keys);
+
+      static auto dispatch(
+            std::size_t const key
+          , Iterator& first, Iterator last, Function& function)
+        -> typename Policy::template result_type<ReturnType>
+      {
+        static constexpr decode_function<ReturnType, Policy, Iterator, Function>
+          entries[] = {
+            message_entry<Keys, ReturnType, Policy, Iterator, Function>(
+                std::integral_constant<
+                  bool, message_keys::index_of(Keys) != message_keys::size
+                >{})...
+          };
+        return entries[key](first, last, function);
+      }
+    };
+
+    template <
+        class Sequence
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    struct basic_multipart_table;
+
+    template <
+        std::size_t... Keys
+      , class ReturnType, class Policy, class Iterator, class Function
+    >
+    struct basic_multipart_table<
+        detail::v13::index_sequence<Keys...>
+      , ReturnType, Policy, Iterator, Function
+    >
+    {
+      static constexpr std::size_t size = sizeof...(Keys);
+
+      static auto dispatch(
+            std::size_t const key
+          , Iterator& first, Iterator last, Function& function)
+        -> typename Policy::template result_type<ReturnType>
+      {
+        static constexpr decode_function<ReturnType, Policy, Iterator, Function>
+          entries[sizeof...(Keys) ? sizeof...(Keys) : 1] = {
+            multipart_entry<Keys, ReturnType, Policy, Iterator, Function>(
+                std::integral_constant<
+                  bool, multipart_keys::index_of(Keys) != multipart_keys::size
+                >{})...
+          };
+        return entries[key](first, last, function);
+      }
+    };
+
+    static constexpr std::size_t message_table_size
+      = (message_keys::table_size > multipart_message_type + 1)
+        || (multipart_message_type == std::size_t(-1))
+      ? message_keys::table_size : multipart_message_type + 1;
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    using message_table = basic_message_table<
+        typename detail::v13::make_index_sequence<
+          message_table_size
+        >::type
+      , ReturnType, Policy, Iterator, Function
+    >;
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    using multipart_table = basic_multipart_table<
+        typename detail::v13::make_index_sequence<
+          multipart_keys::table_size
+        >::type
+      , ReturnType, Policy, Iterator, Function
+    >;
+  };
+
+  using message_decoder = basic_message_decoder<
+    default_switch_message_list, default_multipart_reply_list
+  >;
+
+  using controller_message_decoder = basic_message_decoder<
+    default_controller_message_list, default_multipart_request_list
+  >;
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_MESSAGE_DECODER_HPP
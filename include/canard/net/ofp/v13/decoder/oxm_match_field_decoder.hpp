@@ -4,10 +4,12 @@
 #include <cstdint>
 #include <iterator>
 #include <tuple>
-#include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/v13/common/oxm_header.hpp>
 #include <canard/net/ofp/v13/common/oxm_match_field.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/decode_table.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -16,65 +18,102 @@ namespace net {
 namespace ofp {
 namespace v13 {
 
-  struct oxm_match_field_decoder
+  template <class OXMMatchFieldList>
+  struct basic_oxm_match_field_decoder
   {
     using header_type = std::uint32_t;
     using type_id = std::uint32_t;
-    using decode_type_list = default_oxm_match_field_list;
+    using decode_type_list = OXMMatchFieldList;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
-    static_assert(
-          std::tuple_size<decode_type_list>::value == 40
-        , "not match to the number of oxm match types");
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return header_size + oxm_header_ops::oxm_length(header);
+    }
 
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const oxm_header
         = v13::oxm_header::decode_without_consumption(first, last);
 
       if (std::distance(first, last)
           < std::uint16_t(oxm_header.length() + oxm_header.oxm_length())) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match_field"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
-      switch (oxm_header.oxm_type()) {
-
-#     define CANARD_NET_OFP_V13_MATCH_FIELD_CASE(z, N, _) \
-      using field ## N = std::tuple_element<N, decode_type_list>::type; \
-      case field ## N::oxm_type(): \
-        if (!field ## N::is_valid_oxm_match_field_length(oxm_header)) { \
-          throw exception{ \
-              protocol::bad_match_code::bad_len \
-            , "invalid oxm_match_field length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
-        } \
-        return function(field ## N::decode(first, last));
+      return field_table::template dispatch<
+        basic_oxm_match_field_decoder, ReturnType, Policy
+      >(oxm_header.oxm_type(), oxm_header, first, last, function);
+    }
 
-      BOOST_PP_REPEAT(40, CANARD_NET_OFP_V13_MATCH_FIELD_CASE, _)
+  private:
+    using field_table = detail::v13::decode_table<
+      detail::v13::oxm_type_key, OXMMatchFieldList
+    >;
 
-#     undef CANARD_NET_OFP_V13_MATCH_FIELD_CASE
+    template <class, class>
+    friend class detail::v13::decode_table;
 
-      default:
-        throw exception{
-          protocol::bad_match_code::bad_field, "unknown oxm_match_field"
-        } << CANARD_NET_OFP_ERROR_INFO();
+    template <
+        class T, class ReturnType, class Policy, class Iterator, class Function
+    >
+    static auto decode_type(
+          v13::oxm_header const& oxm_header
+        , Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      if (!T::is_valid_oxm_match_field_length(oxm_header)) {
+        return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_match_code::bad_len, "invalid oxm_match_field length"
+        });
       }
+      return Policy::template decode<ReturnType, T>(first, last, function);
     }
 
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto unknown_type(
+        v13::oxm_header const&, Iterator&, Iterator, Function&)
+      -> typename Policy::template result_type<ReturnType>
     {
-      return decode<ReturnType>(first, last, function);
+      return Policy::template error<ReturnType>(decode_error{
+        protocol::bad_match_code::bad_field, "unknown oxm_match_field"
+      });
     }
   };
 
+  using oxm_match_field_decoder
+    = basic_oxm_match_field_decoder<default_oxm_match_field_list>;
+
 } // namespace v13
 } // namespace ofp
 } // namespace net
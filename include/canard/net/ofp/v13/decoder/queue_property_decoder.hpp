@@ -6,7 +6,9 @@
 #include <tuple>
 #include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/queue_properties.hpp>
@@ -23,6 +25,12 @@ namespace v13 {
     using decode_type_list = default_queue_property_list;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return header.len;
+    }
+
     static_assert(
           std::tuple_size<decode_type_list>::value == 2
         , "not match to the number of queue property types");
@@ -30,15 +38,39 @@ namespace v13 {
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const prop_header
         = detail::decode_without_consumption<header_type>(first, last);
 
       if (std::distance(first, last) < prop_header.len) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for queue_property"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       switch (prop_header.property) {
@@ -47,34 +79,27 @@ namespace v13 {
       using property ## N = std::tuple_element<N, decode_type_list>::type; \
       case property ## N::property(): \
         if (!property ## N::is_valid_queue_property_length(prop_header)) { \
-          throw exception{ \
+          return Policy::template error<ReturnType>(decode_error{ \
               exception::ex_error_type::bad_queue_property \
             , exception::ex_error_code::bad_length \
             , "invalid queue_property length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
+          }); \
         } \
-        return function(property ## N::decode(first, last));
+        return Policy::template decode<ReturnType, property ## N>( \
+            first, last, function);
 
       BOOST_PP_REPEAT(2, CANARD_NET_OFP_V13_QUEUE_PROPERTY_CASE, _)
 
 #     undef  CANARD_NET_OFP_V13_QUEUE_PROPERTY_CASE
 
       default:
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             exception::ex_error_type::bad_queue_property
           , exception::ex_error_code::bad_length
           , "unknwon queue_property"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
     }
-
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
-    {
-      return decode<ReturnType>(first, last, function);
-    }
   };
 
 } // namespace v13
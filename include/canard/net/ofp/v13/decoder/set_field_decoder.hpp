@@ -3,11 +3,13 @@
 
 #include <cstdint>
 #include <tuple>
-#include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/v13/action/set_field.hpp>
 #include <canard/net/ofp/v13/common/oxm_header.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/decode_table.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -17,20 +19,41 @@ namespace net {
 namespace ofp {
 namespace v13 {
 
-  struct set_field_decoder
+  template <class SetFieldList>
+  struct basic_set_field_decoder
   {
     using header_type = protocol::ofp_action_set_field;
     using type_id = std::uint32_t;
-    using decode_type_list = default_set_field_list;
+    using decode_type_list = SetFieldList;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
-    static_assert(
-          std::tuple_size<default_set_field_list>::value == 36
-        , "not match to the number of set_field types");
-
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const set_field
         = detail::decode_without_consumption<header_type>(first, last);
@@ -40,47 +63,55 @@ namespace v13 {
 
       if (set_field.len != detail::v13::exact_length(
             header_size + oxm_header.oxm_length())) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
           protocol::bad_action_code::bad_set_len, "invalid set_field length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
-      switch (oxm_header.oxm_type()) {
-
-#     define CANARD_NET_OFP_V13_SET_FIELD_CASE(z, N, _) \
-      using set_field ## N = \
-            std::tuple_element<N, default_set_field_list>::type; \
-      case set_field ## N::oxm_type(): \
-        if (!set_field ## N::oxm_match_field \
-            ::is_valid_oxm_match_field_length(oxm_header)) { \
-          throw exception{ \
-              protocol::bad_action_code::bad_set_len \
-            , "invalid set_field's oxm_match_field length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
-        } \
-        return function(set_field ## N::decode(first, last));
-
-      BOOST_PP_REPEAT(36, CANARD_NET_OFP_V13_SET_FIELD_CASE, _)
-
-#     undef CANARD_NET_OFP_V13_SET_FIELD_CASE
-
-      default:
-        throw exception{
-            protocol::bad_action_code::bad_set_type
-          , "unknwon set_field's oxm_match_field type"
-        } << CANARD_NET_OFP_ERROR_INFO();
+      return set_field_table::template dispatch<
+        basic_set_field_decoder, ReturnType, Policy
+      >(oxm_header.oxm_type(), oxm_header, first, last, function);
+    }
+
+  private:
+    using set_field_table = detail::v13::decode_table<
+      detail::v13::oxm_type_key, SetFieldList
+    >;
+
+    template <class, class>
+    friend class detail::v13::decode_table;
+
+    template <
+        class T, class ReturnType, class Policy, class Iterator, class Function
+    >
+    static auto decode_type(
+          v13::oxm_header const& oxm_header
+        , Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      if (!T::oxm_match_field::is_valid_oxm_match_field_length(oxm_header)) {
+        return Policy::template error<ReturnType>(decode_error{
+            protocol::bad_action_code::bad_set_len
+          , "invalid set_field's oxm_match_field length"
+        });
       }
+      return Policy::template decode<ReturnType, T>(first, last, function);
     }
 
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto unknown_type(
+        v13::oxm_header const&, Iterator&, Iterator, Function&)
+      -> typename Policy::template result_type<ReturnType>
     {
-      return decode<ReturnType>(first, last, function);
+      return Policy::template error<ReturnType>(decode_error{
+          protocol::bad_action_code::bad_set_type
+        , "unknwon set_field's oxm_match_field type"
+      });
     }
   };
 
+  using set_field_decoder = basic_set_field_decoder<default_set_field_list>;
+
 } // namespace v13
 } // namespace ofp
 } // namespace net
@@ -7,7 +7,10 @@
 #include <boost/preprocessor/repeat.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/v13/table_feature_properties.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+#include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -25,6 +28,12 @@ namespace v13 {
     using decode_type_list = default_table_feature_property_list;
     static constexpr std::uint16_t header_size = sizeof(header_type);
 
+    static auto byte_length_from_header(header_type const& header) noexcept
+      -> std::uint16_t
+    {
+      return detail::v13::exact_length(header.length);
+    }
+
     static_assert(
           std::tuple_size<decode_type_list>::value
             == CANARD_NET_OFP_NUM_TABLE_FEATURE_PROPERTIES
@@ -33,15 +42,39 @@ namespace v13 {
     template <class ReturnType, class Iterator, class Function>
     static auto decode(Iterator& first, Iterator last, Function function)
       -> ReturnType
+    {
+      return decode_impl<ReturnType, detail::v13::throw_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto try_decode(Iterator& first, Iterator last, Function function)
+      -> decode_result<ReturnType>
+    {
+      return decode_impl<ReturnType, detail::v13::return_decode_error>(
+          first, last, function);
+    }
+
+    template <class ReturnType, class Iterator, class Function>
+    static auto decode_without_consumption(
+        Iterator first, Iterator last, Function function)
+      -> ReturnType
+    {
+      return decode<ReturnType>(first, last, function);
+    }
+
+    template <class ReturnType, class Policy, class Iterator, class Function>
+    static auto decode_impl(Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
     {
       auto const header
         = detail::decode_without_consumption<header_type>(first, last);
 
       if (std::distance(first, last) < header.length) {
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for table_feature_property"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       switch (header.type) {
@@ -50,12 +83,13 @@ namespace v13 {
       using property ## N = std::tuple_element<N, decode_type_list>::type; \
       case property ## N::type(): \
         if (!property ## N::is_valid_table_feature_property_length(header)) { \
-          throw exception{ \
+          return Policy::template error<ReturnType>(decode_error{ \
               protocol::table_features_failed_code::bad_len \
             , "invalid table_feature_property length" \
-          } << CANARD_NET_OFP_ERROR_INFO(); \
+          }); \
         } \
-        return function(property ## N::decode(first, last));
+        return Policy::template decode<ReturnType, property ## N>( \
+            first, last, function);
 
       BOOST_PP_REPEAT(
             CANARD_NET_OFP_NUM_TABLE_FEATURE_PROPERTIES
@@ -65,20 +99,12 @@ namespace v13 {
 #     undef CANARD_NET_OFP_V13_TABLE_FEATURE_PROPERTY_CASE
 
       default:
-        throw exception{
+        return Policy::template error<ReturnType>(decode_error{
             protocol::table_features_failed_code::bad_type
           , "unknwon table feature property type"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
     }
-
-    template <class ReturnType, class Iterator, class Function>
-    static auto decode_without_consumption(
-        Iterator first, Iterator last, Function function)
-      -> ReturnType
-    {
-      return decode<ReturnType>(first, last, function);
-    }
   };
 
 } // namespace v13
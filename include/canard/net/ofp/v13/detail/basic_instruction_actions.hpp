@@ -12,6 +12,7 @@
 #include <canard/net/ofp/v13/action_list.hpp>
 #include <canard/net/ofp/v13/detail/basic_instruction.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
 namespace canard {
@@ -44,8 +45,8 @@ namespace v13 {
     auto extract_actions()
       -> ofp::v13::action_list
     {
-      auto actions = ofp::v13::action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       instruction_actions_.len = sizeof(ofp_type);
       return actions;
     }
@@ -78,7 +79,7 @@ namespace v13 {
 
     basic_instruction_actions(basic_instruction_actions const&) = default;
 
-    basic_instruction_actions(basic_instruction_actions&& other)
+    basic_instruction_actions(basic_instruction_actions&& other) noexcept
       : instruction_actions_(other.instruction_actions_)
       , actions_(other.extract_actions())
     {
@@ -123,12 +124,22 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> T
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<T>
     {
       auto const instruction_actions
         = detail::decode<ofp_type>(first, last);
       last = std::next(first, instruction_actions.len - sizeof(ofp_type));
-      auto actions = ofp::v13::action_list::decode(first, last);
-      return T{instruction_actions, std::move(actions)};
+      auto actions = ofp::v13::action_list::decode(first, last, policy);
+      if (Policy::failed(actions)) {
+        return Policy::template error<T>(Policy::error_of(actions));
+      }
+      return T{instruction_actions, std::move(Policy::value_of(actions))};
     }
 
     auto equal_impl(T const& rhs) const noexcept
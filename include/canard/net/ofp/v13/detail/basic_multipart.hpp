@@ -11,8 +11,10 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -330,7 +332,7 @@ namespace multipart_detail {
         single_element_with_match_multipart const&) = default;
 
     single_element_with_match_multipart(
-        single_element_with_match_multipart&& other)
+        single_element_with_match_multipart&& other) noexcept
       : multipart_(other.multipart_)
       , body_(other.body_)
       , match_(other.extract_match())
@@ -395,6 +397,13 @@ namespace multipart_detail {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> T
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<T>
     {
       auto const multipart = detail::decode<ofp_type>(first, last);
       last = std::next(first, multipart.header.length - sizeof(ofp_type));
@@ -403,17 +412,22 @@ namespace multipart_detail {
 
       auto const ofp_match
         = detail::decode_without_consumption<protocol::ofp_match>(first, last);
-      oxm_match::validate_header(ofp_match);
+      if (auto const error = oxm_match::try_validate_header(ofp_match)) {
+        return Policy::template error<T>(error);
+      }
       if (std::distance(first, last)
           != detail::v13::exact_length(ofp_match.length)) {
-        throw exception{
+        return Policy::template error<T>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
+      }
+      auto match = oxm_match::decode(first, last, policy);
+      if (Policy::failed(match)) {
+        return Policy::template error<T>(Policy::error_of(match));
       }
-      auto match = oxm_match::decode(first, last);
 
-      return T{multipart, body, std::move(match)};
+      return T{multipart, body, std::move(Policy::value_of(match))};
     }
 
     auto equal_impl(T const& rhs) const noexcept
@@ -451,8 +465,8 @@ namespace multipart_detail {
     auto extract_body()
       -> body_type
     {
-      auto body = body_type{};
-      body.swap(body_);
+      auto body = std::move(body_);
+      body_.clear();
       multipart_.header.length = base_t::min_length();
       return body;
     }
@@ -483,7 +497,7 @@ namespace multipart_detail {
 
     array_body_multipart(array_body_multipart const&) = default;
 
-    array_body_multipart(array_body_multipart&& other)
+    array_body_multipart(array_body_multipart&& other) noexcept
       : multipart_(other.multipart_)
       , body_(other.extract_body())
     {
@@ -542,14 +556,24 @@ namespace multipart_detail {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> T
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<T>
     {
       auto const multipart = detail::decode<ofp_type>(first, last);
       auto const body_length = multipart.header.length - sizeof(ofp_type);
       last = std::next(first, body_length);
 
-      auto body = body_type::decode(first, last);
+      auto body = body_type::decode(first, last, policy);
+      if (Policy::failed(body)) {
+        return Policy::template error<T>(Policy::error_of(body));
+      }
 
-      return T{multipart, std::move(body)};
+      return T{multipart, std::move(Policy::value_of(body))};
     }
 
     auto equal_impl(T const& rhs) const noexcept
@@ -100,6 +100,8 @@ namespace v13 {
       });
     }
 
+    struct raw_value_tag {};
+
   } // namespace basic_oxm_match_field_detail
 
   template <class T, class OXMMatchFieldTraits>
@@ -132,7 +134,7 @@ namespace v13 {
     auto oxm_hasmask() const noexcept
       -> bool
     {
-      return static_cast<bool>(oxm_mask());
+      return has_mask_;
     }
 
     auto oxm_length() const noexcept
@@ -162,15 +164,18 @@ namespace v13 {
     }
 
     auto oxm_value() const noexcept
-      -> value_type const&
+      -> value_type
     {
-      return value_;
+      return OXMMatchFieldTraits::from_oxm_value(value_);
     }
 
     auto oxm_mask() const noexcept
-      -> boost::optional<value_type> const&
+      -> boost::optional<value_type>
     {
-      return mask_;
+      if (!has_mask_) {
+        return boost::none;
+      }
+      return OXMMatchFieldTraits::from_oxm_value(mask_);
     }
 
     static constexpr auto type() noexcept
@@ -239,16 +244,47 @@ namespace v13 {
 
   protected:
     using oxm_value_type = typename OXMMatchFieldTraits::oxm_value_type;
+    using raw_value_tag = basic_oxm_match_field_detail::raw_value_tag;
 
     explicit basic_oxm_match_field(value_type const& value)
-      : value_(value)
-      , mask_{boost::none}
+      : value_(OXMMatchFieldTraits::to_oxm_value(value))
+      , mask_{}
+      , has_mask_{false}
     {
     }
 
     basic_oxm_match_field(value_type const& value, value_type const& mask)
+      : value_(OXMMatchFieldTraits::to_oxm_value(value))
+      , mask_(OXMMatchFieldTraits::to_oxm_value(mask))
+      , has_mask_{true}
+    {
+    }
+
+    // Not trivial on purpose: a trivially copyable field of 9 or 13 bytes
+    // is returned in registers, and each hop of decode spills it to the
+    // stack piecewise, which stalls store forwarding.
+    basic_oxm_match_field(basic_oxm_match_field const& other) noexcept
+      : value_(other.value_)
+      , mask_(other.mask_)
+      , has_mask_{other.has_mask_}
+    {
+    }
+
+    auto operator=(basic_oxm_match_field const&) noexcept
+      -> basic_oxm_match_field& = default;
+
+    basic_oxm_match_field(raw_value_tag, oxm_value_type const& value)
       : value_(value)
-      , mask_{mask}
+      , mask_{}
+      , has_mask_{false}
+    {
+    }
+
+    basic_oxm_match_field(
+        raw_value_tag, oxm_value_type const& value, oxm_value_type const& mask)
+      : value_(value)
+      , mask_(mask)
+      , has_mask_{true}
     {
     }
 
@@ -258,15 +294,15 @@ namespace v13 {
     >;
 
     auto raw_value() const noexcept
-      -> oxm_value_type
+      -> oxm_value_type const&
     {
-      return OXMMatchFieldTraits::to_oxm_value(oxm_value());
+      return value_;
     }
 
     auto raw_mask() const noexcept
-      -> oxm_value_type
+      -> oxm_value_type const&
     {
-      return OXMMatchFieldTraits::to_oxm_value(*oxm_mask());
+      return mask_;
     }
 
     template <class Container>
@@ -373,8 +409,9 @@ namespace v13 {
     auto equal_impl(T const& rhs) const noexcept
       -> bool
     {
-      return oxm_mask() == rhs.oxm_mask()
-          && oxm_value() == rhs.oxm_value();
+      return has_mask_ == rhs.has_mask_
+          && value_ == rhs.value_
+          && mask_ == rhs.mask_;
     }
 
     auto equivalent_impl(T const& rhs) const noexcept
@@ -385,15 +422,18 @@ namespace v13 {
       }
       if (is_exact()) {
         return rhs.is_exact()
-            && oxm_value() == rhs.oxm_value();
+            && value_ == rhs.value_;
       }
-      return oxm_mask() == rhs.oxm_mask()
-          && oxm_value() == rhs.oxm_value();
+      return equal_impl(rhs);
     }
 
   private:
-    value_type value_;
-    boost::optional<value_type> mask_;
+    // The value and the mask are held as they are on the wire, and are
+    // converted to value_type only by the accessors. The mask is zero
+    // filled unless has_mask_ is set.
+    oxm_value_type value_;
+    oxm_value_type mask_;
+    bool has_mask_;
   };
 
 } // namespace detail
@@ -0,0 +1,153 @@
+#ifndef CANARD_NET_OFP_V13_DETAIL_DECODE_POLICY_HPP
+#define CANARD_NET_OFP_V13_DETAIL_DECODE_POLICY_HPP
+
+#include <type_traits>
+#include <utility>
+#include <canard/net/ofp/v13/decode_result.hpp>
+#include <canard/net/ofp/v13/exception.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace detail {
+namespace v13 {
+
+  // A decode policy chooses how a decode reports malformed input: by
+  // throwing v13::exception or by returning a decode_result. Types whose
+  // body can be malformed take it as T::decode(first, last, policy), and
+  // pass on the result of a nested decode through failed, value_of and
+  // error_of.
+  struct throw_decode_error
+  {
+    template <class ReturnType>
+    using result_type = ReturnType;
+
+    template <class ReturnType>
+    [[noreturn]] static auto error(ofp::v13::decode_error const& error)
+      -> ReturnType
+    {
+      throw ofp::v13::exception{
+        error.error_type(), error.error_code(), error.what()
+      } << CANARD_NET_OFP_ERROR_INFO();
+    }
+
+    template <class ReturnType>
+    [[noreturn]] static auto length_error(char const* const what)
+      -> ReturnType
+    {
+      throw ofp::v13::exception{
+        ofp::v13::protocol::bad_request_code::bad_len, what
+      } << CANARD_NET_OFP_ERROR_INFO();
+    }
+
+    template <class T>
+    static auto failed(T const&) noexcept
+      -> bool
+    {
+      return false;
+    }
+
+    template <class T>
+    static auto value_of(T& t) noexcept
+      -> T&
+    {
+      return t;
+    }
+
+    // never called, since failed is always false
+    template <class T>
+    static auto error_of(T const&) noexcept
+      -> ofp::v13::decode_error
+    {
+      return ofp::v13::decode_error{};
+    }
+
+    template <class ReturnType, class T, class Iterator, class Function>
+    static auto decode(Iterator& first, Iterator last, Function& function)
+      -> ReturnType
+    {
+      return function(T::decode(first, last));
+    }
+  };
+
+  struct return_decode_error
+  {
+    template <class ReturnType>
+    using result_type = ofp::v13::decode_result<ReturnType>;
+
+    template <class ReturnType>
+    static auto error(ofp::v13::decode_error const& error) noexcept
+      -> result_type<ReturnType>
+    {
+      return result_type<ReturnType>{error};
+    }
+
+    template <class ReturnType>
+    static auto length_error(char const* const what) noexcept
+      -> result_type<ReturnType>
+    {
+      return error<ReturnType>(ofp::v13::decode_error{
+        ofp::v13::protocol::bad_request_code::bad_len, what
+      });
+    }
+
+    template <class T>
+    static auto failed(result_type<T> const& result) noexcept
+      -> bool
+    {
+      return !result;
+    }
+
+    template <class T>
+    static auto value_of(result_type<T>& result) noexcept
+      -> T&
+    {
+      return result.value();
+    }
+
+    template <class T>
+    static auto error_of(result_type<T> const& result) noexcept
+      -> ofp::v13::decode_error
+    {
+      return result.error();
+    }
+
+    // T::decode reports the errors in its body (e.g. a malformed nested
+    // list) through this policy, so nothing but std::bad_alloc is thrown.
+    template <class ReturnType, class T, class Iterator, class Function>
+    static auto decode(Iterator& first, Iterator last, Function& function)
+      -> result_type<ReturnType>
+    {
+      auto value = T::decode(first, last, return_decode_error{});
+      if (failed(value)) {
+        return error<ReturnType>(value.error());
+      }
+      return invoke<ReturnType>(
+          function, std::move(value.value()), std::is_void<ReturnType>{});
+    }
+
+  private:
+    template <class ReturnType, class Function, class T>
+    static auto invoke(Function& function, T&& t, std::false_type)
+      -> result_type<ReturnType>
+    {
+      return result_type<ReturnType>{function(std::forward<T>(t))};
+    }
+
+    template <class ReturnType, class Function, class T>
+    static auto invoke(Function& function, T&& t, std::true_type)
+      -> result_type<ReturnType>
+    {
+      function(std::forward<T>(t));
+      return result_type<ReturnType>{};
+    }
+  };
+
+} // namespace v13
+} // namespace detail
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_DETAIL_DECODE_POLICY_HPP
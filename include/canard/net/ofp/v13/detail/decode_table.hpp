@@ -0,0 +1,340 @@
+#ifndef CANARD_NET_OFP_DETAIL_V13_DECODE_TABLE_HPP
+#define CANARD_NET_OFP_DETAIL_V13_DECODE_TABLE_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace detail {
+namespace v13 {
+
+  template <std::size_t... Is>
+  struct index_sequence {};
+
+  template <std::size_t N, std::size_t... Is>
+  struct make_index_sequence
+    : make_index_sequence<N - 1, N - 1, Is...>
+  {};
+
+  template <std::size_t... Is>
+  struct make_index_sequence<0, Is...>
+  {
+    using type = index_sequence<Is...>;
+  };
+
+  struct type_key
+  {
+    template <class T>
+    static constexpr auto key() noexcept
+      -> std::size_t
+    {
+      return T::type();
+    }
+  };
+
+  struct oxm_type_key
+  {
+    template <class T>
+    static constexpr auto key() noexcept
+      -> std::size_t
+    {
+      return T::oxm_type();
+    }
+  };
+
+  namespace decode_table_detail {
+
+    constexpr auto slot_of(
+        std::size_t const key, std::size_t const base, std::size_t const m)
+      noexcept
+      -> std::size_t
+    {
+      return (key - base) % m;
+    }
+
+    template <class KeyOf>
+    constexpr auto min_key() noexcept
+      -> std::size_t
+    {
+      return std::size_t(-1);
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto min_key() noexcept
+      -> std::size_t
+    {
+      return KeyOf::template key<T>() < min_key<KeyOf, Ts...>()
+        ? KeyOf::template key<T>() : min_key<KeyOf, Ts...>();
+    }
+
+    template <class KeyOf>
+    constexpr auto max_key() noexcept
+      -> std::size_t
+    {
+      return 0;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto max_key() noexcept
+      -> std::size_t
+    {
+      return KeyOf::template key<T>() > max_key<KeyOf, Ts...>()
+        ? KeyOf::template key<T>() : max_key<KeyOf, Ts...>();
+    }
+
+    template <class KeyOf>
+    constexpr auto has_slot(std::size_t, std::size_t, std::size_t) noexcept
+      -> bool
+    {
+      return false;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto has_slot(
+        std::size_t const slot, std::size_t const base, std::size_t const m)
+      noexcept
+      -> bool
+    {
+      return slot_of(KeyOf::template key<T>(), base, m) == slot
+          || decode_table_detail::has_slot<KeyOf, Ts...>(slot, base, m);
+    }
+
+    template <class KeyOf>
+    constexpr auto is_collision_free(std::size_t, std::size_t) noexcept
+      -> bool
+    {
+      return true;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto is_collision_free(
+        std::size_t const base, std::size_t const m) noexcept
+      -> bool
+    {
+      return !decode_table_detail::has_slot<KeyOf, Ts...>(
+                slot_of(KeyOf::template key<T>(), base, m), base, m)
+          && decode_table_detail::is_collision_free<KeyOf, Ts...>(base, m);
+    }
+
+    template <class KeyOf, class... Ts>
+    constexpr auto find_modulus(
+        std::size_t base, std::size_t first, std::size_t last) noexcept
+      -> std::size_t;
+
+    template <class KeyOf, class... Ts>
+    constexpr auto find_modulus_upper(
+          std::size_t const base, std::size_t const lower_result
+        , std::size_t const middle, std::size_t const last) noexcept
+      -> std::size_t
+    {
+      return lower_result != middle
+        ? lower_result
+        : decode_table_detail::find_modulus<KeyOf, Ts...>(base, middle, last);
+    }
+
+    // Returns the smallest modulus in [first, last) which maps every key to
+    // a distinct slot, or last if there is none. The range is bisected to
+    // keep the depth of the constant evaluation logarithmic.
+    template <class KeyOf, class... Ts>
+    constexpr auto find_modulus(
+        std::size_t const base, std::size_t const first, std::size_t const last)
+      noexcept
+      -> std::size_t
+    {
+      return last - first == 1
+        ? (decode_table_detail::is_collision_free<KeyOf, Ts...>(base, first)
+            ? first : last)
+        : decode_table_detail::find_modulus_upper<KeyOf, Ts...>(
+              base
+            , decode_table_detail::find_modulus<KeyOf, Ts...>(
+                base, first, first + (last - first) / 2)
+            , first + (last - first) / 2, last);
+    }
+
+    template <class KeyOf>
+    constexpr auto index_of_slot(
+        std::size_t, std::size_t, std::size_t, std::size_t const i) noexcept
+      -> std::size_t
+    {
+      return i;
+    }
+
+    template <class KeyOf, class T, class... Ts>
+    constexpr auto index_of_slot(
+          std::size_t const slot, std::size_t const base, std::size_t const m
+        , std::size_t const i) noexcept
+      -> std::size_t
+    {
+      return slot_of(KeyOf::template key<T>(), base, m) == slot
+        ? i
+        : decode_table_detail::index_of_slot<KeyOf, Ts...>(
+            slot, base, m, i + 1);
+    }
+
+    template <class DecodeFunction>
+    struct entry
+    {
+      std::size_t key;
+      DecodeFunction decode;
+    };
+
+  } // namespace decode_table_detail
+
+
+  // Dispatches a decoding to the type of the TypeList whose key, given by
+  // KeyOf::key<T>(), matches the key read from the wire.
+  //
+  // The keys are hashed by (key - min_key) % modulus, where modulus is the
+  // smallest value not less than the number of types that gives no
+  // collision. For a dense key set this is a direct index. Each slot holds
+  // the key it was built for, so any other key is reported as unknown.
+  //
+  // The Decoder provides the following static member function templates,
+  // which take (Header const&, Iterator&, Iterator, Function&):
+  //   decode_type<T, ReturnType, Policy, Iterator, Function>
+  //   unknown_type<ReturnType, Policy, Iterator, Function>
+  template <class KeyOf, class TypeList>
+  class decode_table;
+
+  template <class KeyOf, class... Ts>
+  class decode_table<KeyOf, std::tuple<Ts...>>
+  {
+  public:
+    static constexpr std::size_t size = sizeof...(Ts);
+    static constexpr std::size_t min_key
+      = size ? decode_table_detail::min_key<KeyOf, Ts...>() : 0;
+    static constexpr std::size_t max_key
+      = size ? decode_table_detail::max_key<KeyOf, Ts...>() : 0;
+    static constexpr std::size_t modulus
+      = size
+      ? decode_table_detail::find_modulus<KeyOf, Ts...>(
+          min_key, size, max_key - min_key + 2)
+      : 1;
+
+    static_assert(
+          modulus <= max_key - min_key + 1
+        , "the type list has duplicated keys");
+
+    static constexpr auto slot(std::size_t const key) noexcept
+      -> std::size_t
+    {
+      return decode_table_detail::slot_of(key, min_key, modulus);
+    }
+
+    template <
+        class Decoder, class ReturnType, class Policy
+      , class Header, class Iterator, class Function
+    >
+    static auto dispatch(
+          std::size_t const key, Header const& header
+        , Iterator& first, Iterator last, Function& function)
+      -> typename Policy::template result_type<ReturnType>
+    {
+      return table<
+          typename make_index_sequence<modulus>::type
+        , Decoder, ReturnType, Policy, Header, Iterator, Function
+      >::dispatch(key, header, first, last, function);
+    }
+
+  private:
+    template <
+        class ReturnType, class Policy, class Header, class Iterator
+      , class Function
+    >
+    using decode_function
+      = typename Policy::template result_type<ReturnType>(*)(
+          Header const&, Iterator&, Iterator, Function&);
+
+    template <
+        class Sequence, class Decoder, class ReturnType, class Policy
+      , class Header, class Iterator, class Function
+    >
+    struct table;
+
+    template <
+        std::size_t... Slots, class Decoder, class ReturnType, class Policy
+      , class Header, class Iterator, class Function
+    >
+    struct table<
+        index_sequence<Slots...>
+      , Decoder, ReturnType, Policy, Header, Iterator, Function
+    >
+    {
+      using function_type
+        = decode_function<ReturnType, Policy, Header, Iterator, Function>;
+      using entry_type = decode_table_detail::entry<function_type>;
+
+      template <
+          std::size_t Slot
+        , std::size_t Index = decode_table_detail::index_of_slot<KeyOf, Ts...>(
+            Slot, min_key, modulus, 0)
+      >
+      static constexpr auto make_entry(std::true_type) noexcept
+        -> entry_type
+      {
+        using type
+          = typename std::tuple_element<Index, std::tuple<Ts...>>::type;
+        return entry_type{
+            KeyOf::template key<type>()
+          , &Decoder::template decode_type<
+                type, ReturnType, Policy, Iterator, Function>
+        };
+      }
+
+      template <std::size_t Slot>
+      static constexpr auto make_entry(std::false_type) noexcept
+        -> entry_type
+      {
+        return entry_type{
+            std::size_t(-1)
+          , &Decoder::template unknown_type<
+                ReturnType, Policy, Iterator, Function>
+        };
+      }
+
+      static auto dispatch(
+            std::size_t const key, Header const& header
+          , Iterator& first, Iterator last, Function& function)
+        -> typename Policy::template result_type<ReturnType>
+      {
+        static constexpr entry_type entries[] = {
+          make_entry<Slots>(
+              std::integral_constant<
+                  bool
+                , decode_table_detail::index_of_slot<KeyOf, Ts...>(
+                    Slots, min_key, modulus, 0) != size
+              >{})...
+        };
+        auto const& entry = entries[slot(key)];
+        if (entry.key != key) {
+          return Decoder::template unknown_type<
+            ReturnType, Policy, Iterator, Function
+          >(header, first, last, function);
+        }
+        return entry.decode(header, first, last, function);
+      }
+    };
+  };
+
+  template <class KeyOf, class... Ts>
+  constexpr std::size_t decode_table<KeyOf, std::tuple<Ts...>>::size;
+
+  template <class KeyOf, class... Ts>
+  constexpr std::size_t decode_table<KeyOf, std::tuple<Ts...>>::min_key;
+
+  template <class KeyOf, class... Ts>
+  constexpr std::size_t decode_table<KeyOf, std::tuple<Ts...>>::max_key;
+
+  template <class KeyOf, class... Ts>
+  constexpr std::size_t decode_table<KeyOf, std::tuple<Ts...>>::modulus;
+
+} // namespace v13
+} // namespace detail
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_DETAIL_V13_DECODE_TABLE_HPP
@@ -11,8 +11,10 @@
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/any_instruction.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -66,8 +68,8 @@ namespace flow_mod_detail {
     auto extract_instructions()
       -> instructions_type
     {
-      auto instructions = instructions_type{};
-      instructions.swap(instructions_);
+      auto instructions = std::move(instructions_);
+      instructions_.clear();
       flow_mod_.header.length = sizeof(ofp_type) + match_.byte_length();
       return instructions;
     }
@@ -157,7 +159,7 @@ namespace flow_mod_detail {
 
     flow_mod_base(flow_mod_base const&) = default;
 
-    flow_mod_base(flow_mod_base&& other)
+    flow_mod_base(flow_mod_base&& other) noexcept
       : flow_mod_(other.flow_mod_)
       , match_(other.extract_match())
       , instructions_(other.extract_instructions())
@@ -211,26 +213,44 @@ namespace flow_mod_detail {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> FlowMod
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<FlowMod>
     {
       auto const flow_mod = detail::decode<ofp_type>(first, last);
       last = std::next(first, flow_mod.header.length - sizeof(ofp_type));
 
       auto const ofp_match
         = detail::decode_without_consumption<protocol::ofp_match>(first, last);
-      oxm_match::validate_header(ofp_match);
+      if (auto const error = oxm_match::try_validate_header(ofp_match)) {
+        return Policy::template error<FlowMod>(error);
+      }
       if (std::distance(first, last)
           < detail::v13::exact_length(ofp_match.length)) {
-        throw exception{
+        return Policy::template error<FlowMod>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
+      }
+      auto match = oxm_match::decode(first, last, policy);
+      if (Policy::failed(match)) {
+        return Policy::template error<FlowMod>(Policy::error_of(match));
       }
-      auto match = oxm_match::decode(first, last);
 
-      auto instructions = instructions_type::decode(first, last);
+      auto instructions = instructions_type::decode(first, last, policy);
+      if (Policy::failed(instructions)) {
+        return Policy::template error<FlowMod>(
+            Policy::error_of(instructions));
+      }
 
       return FlowMod{
-        flow_mod, std::move(match), std::move(instructions)
+          flow_mod
+        , std::move(Policy::value_of(match))
+        , std::move(Policy::value_of(instructions))
       };
     }
 
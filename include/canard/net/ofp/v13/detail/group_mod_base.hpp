@@ -11,6 +11,7 @@
 #include <canard/net/ofp/v13/common/bucket.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
 namespace canard {
@@ -65,8 +66,8 @@ namespace v13 {
     auto extract_buckets()
       -> buckets_type
     {
-      auto buckets = buckets_type{};
-      buckets.swap(buckets_);
+      auto buckets = std::move(buckets_);
+      buckets_.clear();
       group_mod_.header.length = sizeof(ofp_type);
       return buckets;
     }
@@ -115,7 +116,7 @@ namespace v13 {
 
     group_mod_base(group_mod_base const&) = default;
 
-    group_mod_base(group_mod_base&& other)
+    group_mod_base(group_mod_base&& other) noexcept
       : group_mod_(other.group_mod_)
       , buckets_(other.extract_buckets())
     {
@@ -153,15 +154,25 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> GroupMod
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<GroupMod>
     {
       auto const group_mod = detail::decode<ofp_type>(first, last);
       auto const buckets_length
         = group_mod.header.length - sizeof(ofp_type);
       last = std::next(first, buckets_length);
 
-      auto buckets = buckets_type::decode(first, last);
+      auto buckets = buckets_type::decode(first, last, policy);
+      if (Policy::failed(buckets)) {
+        return Policy::template error<GroupMod>(Policy::error_of(buckets));
+      }
 
-      return GroupMod{group_mod, std::move(buckets)};
+      return GroupMod{group_mod, std::move(Policy::value_of(buckets))};
     }
 
     auto equal_impl(GroupMod const& rhs) const noexcept
@@ -7,6 +7,7 @@
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/any_meter_band.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
 namespace canard {
@@ -61,8 +62,8 @@ namespace v13 {
     auto extract_bands()
       -> bands_type
     {
-      auto bands = bands_type{};
-      bands.swap(bands_);
+      auto bands = std::move(bands_);
+      bands_.clear();
       meter_mod_.header.length = sizeof(ofp_type);
       return std::move(bands);
     }
@@ -108,7 +109,7 @@ namespace v13 {
 
     meter_mod_base(meter_mod_base const&) = default;
 
-    meter_mod_base(meter_mod_base&& other)
+    meter_mod_base(meter_mod_base&& other) noexcept
       : meter_mod_(other.meter_mod_)
       , bands_(other.extract_bands())
     {
@@ -170,12 +171,22 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> MeterMod
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<MeterMod>
     {
       auto const meter_mod = ofp::detail::decode<ofp_type>(first, last);
       auto const bands_length = meter_mod.header.length - sizeof(ofp_type);
       last = std::next(first, bands_length);
-      auto bands = bands_type::decode(first, last);
-      return MeterMod{meter_mod, std::move(bands)};
+      auto bands = bands_type::decode(first, last, policy);
+      if (Policy::failed(bands)) {
+        return Policy::template error<MeterMod>(Policy::error_of(bands));
+      }
+      return MeterMod{meter_mod, std::move(Policy::value_of(bands))};
     }
 
     auto equal_impl(MeterMod const& rhs) const noexcept
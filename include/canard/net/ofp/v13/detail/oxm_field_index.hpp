@@ -0,0 +1,151 @@
+#ifndef CANARD_NET_OFP_V13_DETAIL_OXM_FIELD_INDEX_HPP
+#define CANARD_NET_OFP_V13_DETAIL_OXM_FIELD_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <boost/assert.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace detail {
+namespace v13 {
+
+  // maps each OpenFlow basic oxm_field to the position of its first
+  // occurrence in an oxm_match field list. The positions are stored in the
+  // order of the oxm_field values present, so that only as many slots as
+  // fields are needed. Fields beyond max_indexed_fields, or located beyond
+  // max_position, are in the bitmap but have no position.
+  class oxm_field_index
+  {
+  public:
+    using bitmap_type = std::uint64_t;
+    using position_type = std::uint8_t;
+
+    static constexpr std::size_t num_fields = 40;
+    static constexpr std::size_t max_indexed_fields = 16;
+    static constexpr std::size_t max_position
+      = std::numeric_limits<position_type>::max() - 1;
+    static constexpr std::size_t npos = std::size_t(-1);
+
+    oxm_field_index() noexcept
+      : bitmap_(0)
+      , positions_{}
+    {
+    }
+
+    template <class OXMFields>
+    explicit oxm_field_index(OXMFields const& oxm_fields) noexcept
+      : oxm_field_index{}
+    {
+      for (auto const& field : oxm_fields) {
+        if (is_indexable(field)) {
+          bitmap_ |= bit(field.oxm_field());
+        }
+      }
+
+      auto seen = bitmap_type{0};
+      auto position = std::size_t{0};
+      for (auto const& field : oxm_fields) {
+        if (is_indexable(field) && !(seen & bit(field.oxm_field()))) {
+          seen |= bit(field.oxm_field());
+          auto const rank = rank_of(field.oxm_field());
+          if (rank < max_indexed_fields) {
+            positions_[rank] = position <= max_position
+              ? position_type(position) : position_type(unindexed);
+          }
+        }
+        ++position;
+      }
+    }
+
+    static constexpr auto bit(std::uint8_t const oxm_field) noexcept
+      -> bitmap_type
+    {
+      return bitmap_type{1} << oxm_field;
+    }
+
+    template <class OXMMatchField>
+    static constexpr auto bits() noexcept
+      -> bitmap_type
+    {
+      return bit(OXMMatchField::oxm_field());
+    }
+
+    template <
+        class OXMMatchField1, class OXMMatchField2, class... OXMMatchFields
+    >
+    static constexpr auto bits() noexcept
+      -> bitmap_type
+    {
+      return bits<OXMMatchField1>()
+           | bits<OXMMatchField2, OXMMatchFields...>();
+    }
+
+    auto bitmap() const noexcept
+      -> bitmap_type
+    {
+      return bitmap_;
+    }
+
+    auto contains(bitmap_type const bits) const noexcept
+      -> bool
+    {
+      return (bitmap_ & bits) == bits;
+    }
+
+    // returns npos if the field has no position, in which case the caller
+    // has to search the field list
+    auto position(std::uint8_t const oxm_field) const noexcept
+      -> std::size_t
+    {
+      BOOST_ASSERT(contains(bit(oxm_field)));
+      auto const rank = rank_of(oxm_field);
+      if (rank >= max_indexed_fields || positions_[rank] == unindexed) {
+        return npos;
+      }
+      return positions_[rank];
+    }
+
+  private:
+    static constexpr position_type unindexed
+      = std::numeric_limits<position_type>::max();
+
+    template <class OXMMatchField>
+    static auto is_indexable(OXMMatchField const& field) noexcept
+      -> bool
+    {
+      return field.oxm_class() == ofp::v13::protocol::OFPXMC_OPENFLOW_BASIC
+          && field.oxm_field() < num_fields;
+    }
+
+    static auto popcount(bitmap_type bits) noexcept
+      -> std::size_t
+    {
+      bits = bits - ((bits >> 1) & 0x5555555555555555);
+      bits = (bits & 0x3333333333333333) + ((bits >> 2) & 0x3333333333333333);
+      bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0f;
+      return std::size_t((bits * 0x0101010101010101) >> 56);
+    }
+
+    // the number of fields present whose oxm_field is smaller
+    auto rank_of(std::uint8_t const oxm_field) const noexcept
+      -> std::size_t
+    {
+      return popcount(bitmap_ & (bit(oxm_field) - 1));
+    }
+
+  private:
+    bitmap_type bitmap_;
+    position_type positions_[max_indexed_fields];
+  };
+
+} // namespace v13
+} // namespace detail
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_DETAIL_OXM_FIELD_INDEX_HPP
@@ -39,7 +39,7 @@ namespace hello_elements {
 
     unknown_element(unknown_element const&) = default;
 
-    unknown_element(unknown_element&& other)
+    unknown_element(unknown_element&& other) noexcept
       : header_(other.header_)
       , data_(other.extract_data())
     {
@@ -51,7 +51,7 @@ namespace hello_elements {
       return operator=(unknown_element{other});
     }
 
-    auto operator=(unknown_element&& other)
+    auto operator=(unknown_element&& other) noexcept
       -> unknown_element&
     {
       auto tmp = std::move(other);
@@ -81,8 +81,8 @@ namespace hello_elements {
     auto extract_data()
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       header_.length = sizeof(ofp_type);
       return data;
     }
@@ -55,7 +55,7 @@ namespace hello_elements {
 
     versionbitmap(versionbitmap const&) = default;
 
-    versionbitmap(versionbitmap&& other)
+    versionbitmap(versionbitmap&& other) noexcept
       : versionbitmap_(other.versionbitmap_)
       , bitmaps_(other.extract_bitmaps())
     {
@@ -97,8 +97,8 @@ namespace hello_elements {
     auto extract_bitmaps()
       -> bitmaps_type
     {
-      auto bitmaps = bitmaps_type{};
-      bitmaps.swap(bitmaps_);
+      auto bitmaps = std::move(bitmaps_);
+      bitmaps_.clear();
       versionbitmap_.length = sizeof(ofp_type);
       return bitmaps;
     }
@@ -10,8 +10,10 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/detail/flow_entry_adaptor.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
@@ -91,7 +93,7 @@ namespace messages {
 
     flow_removed(flow_removed const&) = default;
 
-    flow_removed(flow_removed&& other)
+    flow_removed(flow_removed&& other) noexcept
       : flow_removed_(other.flow_removed_)
       , match_(other.extract_match())
     {
@@ -133,8 +135,7 @@ namespace messages {
     auto extract_match()
       -> oxm_match
     {
-      auto match = oxm_match{};
-      match.swap(match_);
+      auto match = std::move(match_);
       flow_removed_.header.length = base_flow_removed_size;
       return match;
     }
@@ -169,6 +170,13 @@ namespace messages {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> flow_removed
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<flow_removed>
     {
       auto const fremoved = detail::decode<ofp_type>(first, last);
 
@@ -177,16 +185,21 @@ namespace messages {
 
       auto const ofp_match
         = detail::decode_without_consumption<protocol::ofp_match>(first, last);
-      oxm_match::validate_header(ofp_match);
+      if (auto const error = oxm_match::try_validate_header(ofp_match)) {
+        return Policy::template error<flow_removed>(error);
+      }
       if (detail::v13::exact_length(ofp_match.length) != match_length) {
-        throw exception{
+        return Policy::template error<flow_removed>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
+      }
+      auto match = oxm_match::decode(first, last, policy);
+      if (Policy::failed(match)) {
+        return Policy::template error<flow_removed>(Policy::error_of(match));
       }
-      auto match = oxm_match::decode(first, last);
 
-      return flow_removed{fremoved, std::move(match)};
+      return flow_removed{fremoved, std::move(Policy::value_of(match))};
     }
 
     auto equal_impl(flow_removed const& rhs) const noexcept
@@ -13,6 +13,7 @@
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/any_hello_element.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/hello_element/versionbitmap.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -103,7 +104,7 @@ namespace messages {
 
     hello(hello const&) = default;
 
-    hello(hello&& other)
+    hello(hello&& other) noexcept
       : hello_(other.hello_)
       , elements_(other.extract_elements())
     {
@@ -123,7 +124,7 @@ namespace messages {
       return *this;
     }
 
-    void swap(hello& other) noexcept
+    void swap(hello& other)
     {
       std::swap(hello_, other.hello_);
       elements_.swap(other.elements_);
@@ -168,8 +169,8 @@ namespace messages {
     auto extract_elements()
       -> hello_elements_type
     {
-      auto elements = hello_elements_type{};
-      elements.swap(elements_);
+      auto elements = std::move(elements_);
+      elements_.clear();
       hello_.header.length = sizeof(ofp_type);
       return elements;
     }
@@ -218,14 +219,24 @@ namespace messages {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> hello
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<hello>
     {
       auto const h = detail::decode<ofp_type>(first, last);
       auto const hello_elements_length = h.header.length - sizeof(ofp_type);
       last = std::next(first, hello_elements_length);
 
-      auto elements = hello_elements_type::decode(first, last);
+      auto elements = hello_elements_type::decode(first, last, policy);
+      if (Policy::failed(elements)) {
+        return Policy::template error<hello>(Policy::error_of(elements));
+      }
 
-      return hello{h, std::move(elements)};
+      return hello{h, std::move(Policy::value_of(elements))};
     }
 
     auto equal_impl(hello const& rhs) const noexcept
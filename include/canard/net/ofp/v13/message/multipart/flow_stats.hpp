@@ -1,10 +1,12 @@
 #ifndef CANARD_NET_OFP_V13_MESSAGES_MULTIPART_FLOW_STATS_HPP
 #define CANARD_NET_OFP_V13_MESSAGES_MULTIPART_FLOW_STATS_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 #include <utility>
+#include <boost/range/iterator_range.hpp>
 #include <canard/net/ofp/detail/basic_protocol_type.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/encode.hpp>
@@ -13,8 +15,11 @@
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/any_instruction.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/common/oxm_match_view.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/detail/flow_entry_adaptor.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
@@ -28,6 +33,108 @@ namespace v13 {
 namespace messages {
 namespace multipart {
 
+  class flow_stats;
+
+  class flow_stats_view
+    : public v13_detail::flow_entry_adaptor<
+        flow_stats_view, protocol::ofp_flow_stats
+      >
+  {
+  public:
+    using ofp_type = protocol::ofp_flow_stats;
+    using instructions_type = ofp::list<any_instruction>;
+    using range_type = boost::iterator_range<unsigned char const*>;
+
+    static constexpr std::uint16_t base_size
+      = sizeof(ofp_type) + oxm_match::min_byte_length();
+
+    auto length() const noexcept
+      -> std::uint16_t
+    {
+      return flow_stats_.length;
+    }
+
+    auto match() const noexcept
+      -> oxm_match_view const&
+    {
+      return match_;
+    }
+
+    auto instruction_data() const noexcept
+      -> range_type
+    {
+      return range_type{instructions_first_, first_ + length()};
+    }
+
+    auto instructions() const
+      -> instructions_type
+    {
+      auto it = instructions_first_;
+      return instructions_type::decode(it, first_ + length());
+    }
+
+    auto data() const noexcept
+      -> range_type
+    {
+      return range_type{first_, first_ + length()};
+    }
+
+    static auto decode(unsigned char const*& first, unsigned char const* last)
+      -> flow_stats_view
+    {
+      auto const element_first = first;
+      auto const stats = detail::decode<ofp_type>(first, last);
+      if (stats.length < base_size) {
+        throw exception{
+            exception::ex_error_type::bad_multipart_element
+          , exception::ex_error_code::bad_length
+          , "too small flow_stats length"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const rest_length = std::size_t(stats.length - sizeof(ofp_type));
+      if (std::size_t(std::distance(first, last)) < rest_length) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for flow_stats"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      last = first + rest_length;
+
+      auto const match = oxm_match_view::decode(first, last);
+      auto const view = flow_stats_view{stats, match, element_first, first};
+      first = last;
+      return view;
+    }
+
+  private:
+    flow_stats_view(
+          ofp_type const& stats
+        , oxm_match_view const& match
+        , unsigned char const* const first
+        , unsigned char const* const instructions_first) noexcept
+      : flow_stats_(stats)
+      , match_(match)
+      , first_(first)
+      , instructions_first_(instructions_first)
+    {
+    }
+
+    friend flow_entry_adaptor;
+    friend flow_stats;
+
+    auto ofp_flow_entry() const noexcept
+      -> ofp_type const&
+    {
+      return flow_stats_;
+    }
+
+  private:
+    ofp_type flow_stats_;
+    oxm_match_view match_;
+    unsigned char const* first_;
+    unsigned char const* instructions_first_;
+  };
+
   class flow_stats
     : public detail::basic_protocol_type<flow_stats>
     , public v13_detail::flow_entry_adaptor<
@@ -37,6 +144,16 @@ namespace multipart {
   public:
     using ofp_type = protocol::ofp_flow_stats;
     using instructions_type = ofp::list<any_instruction>;
+    using header_type = std::uint16_t;
+
+    // the length field leads the element, which lets lists of them be
+    // scanned without decoding the elements
+    static constexpr auto byte_length_from_header(
+        header_type const length) noexcept
+      -> std::uint16_t
+    {
+      return length;
+    }
 
     flow_stats(
           v13::flow_entry entry
@@ -66,9 +183,16 @@ namespace multipart {
     {
     }
 
+    explicit flow_stats(flow_stats_view const& view)
+      : flow_stats_(view.flow_stats_)
+      , match_(view.match().to_oxm_match())
+      , instructions_(view.instructions())
+    {
+    }
+
     flow_stats(flow_stats const&) = default;
 
-    flow_stats(flow_stats&& other)
+    flow_stats(flow_stats&& other) noexcept
       : flow_stats_(other.flow_stats_)
       , match_(other.extract_match())
       , instructions_(other.extract_instructions())
@@ -125,8 +249,8 @@ namespace multipart {
     auto extract_instructions()
       -> instructions_type
     {
-      auto instructions = instructions_type{};
-      instructions.swap(instructions_);
+      auto instructions = std::move(instructions_);
+      instructions_.clear();
       flow_stats_.length = sizeof(ofp_type) + match_.byte_length();
       return instructions;
     }
@@ -179,39 +303,59 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> flow_stats
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<flow_stats>
     {
       auto const stats = detail::decode<ofp_type>(first, last);
       if (stats.length < base_size) {
-        throw exception{
+        return Policy::template error<flow_stats>(decode_error{
             exception::ex_error_type::bad_multipart_element
           , exception::ex_error_code::bad_length
           , "too small flow_stats length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const rest_length = std::uint16_t(stats.length - sizeof(ofp_type));
       if (std::distance(first, last) < rest_length) {
-        throw exception{
+        return Policy::template error<flow_stats>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for flow_stats"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, rest_length);
 
       auto const ofp_match
         = detail::decode_without_consumption<protocol::ofp_match>(first, last);
-      oxm_match::validate_header(ofp_match);
+      if (auto const error = oxm_match::try_validate_header(ofp_match)) {
+        return Policy::template error<flow_stats>(error);
+      }
       if (std::distance(first, last)
           < detail::v13::exact_length(ofp_match.length)) {
-        throw exception{
+        return Policy::template error<flow_stats>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
+      }
+      auto match = oxm_match::decode(first, last, policy);
+      if (Policy::failed(match)) {
+        return Policy::template error<flow_stats>(Policy::error_of(match));
       }
-      auto match = oxm_match::decode(first, last);
 
-      auto instructions = instructions_type::decode(first, last);
+      auto instructions = instructions_type::decode(first, last, policy);
+      if (Policy::failed(instructions)) {
+        return Policy::template error<flow_stats>(
+            Policy::error_of(instructions));
+      }
 
-      return flow_stats{stats, std::move(match), std::move(instructions)};
+      return flow_stats{
+          stats
+        , std::move(Policy::value_of(match))
+        , std::move(Policy::value_of(instructions))
+      };
     }
 
     auto equal_impl(flow_stats const& rhs) const noexcept
@@ -375,6 +519,230 @@ namespace multipart {
     }
   };
 
+  // A flow_stats_reply whose elements are decoded one at a time while it is
+  // iterated, without materializing the body. The element lengths are
+  // checked by decode, but the elements themselves are checked on access.
+  class flow_stats_reply_view
+  {
+  public:
+    using ofp_type = protocol::ofp_multipart_reply;
+    using range_type = boost::iterator_range<unsigned char const*>;
+
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = flow_stats_view;
+      using difference_type = std::ptrdiff_t;
+      using pointer = flow_stats_view const*;
+      using reference = flow_stats_view;
+
+      const_iterator() noexcept
+        : first_(nullptr)
+      {
+      }
+
+      explicit const_iterator(unsigned char const* const first) noexcept
+        : first_(first)
+      {
+      }
+
+      auto operator*() const
+        -> reference
+      {
+        auto it = first_;
+        return flow_stats_view::decode(it, first_ + element_length());
+      }
+
+      auto operator++() noexcept
+        -> const_iterator&
+      {
+        first_ += element_length();
+        return *this;
+      }
+
+      auto operator++(int) noexcept
+        -> const_iterator
+      {
+        auto it = *this;
+        ++*this;
+        return it;
+      }
+
+      friend auto operator==(
+          const_iterator const& lhs, const_iterator const& rhs) noexcept
+        -> bool
+      {
+        return lhs.first_ == rhs.first_;
+      }
+
+      friend auto operator!=(
+          const_iterator const& lhs, const_iterator const& rhs) noexcept
+        -> bool
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+      auto element_length() const noexcept
+        -> std::uint16_t
+      {
+        return std::uint16_t(first_[0] << 8 | first_[1]);
+      }
+
+      unsigned char const* first_;
+    };
+
+    using iterator = const_iterator;
+
+    auto header() const noexcept
+      -> protocol::ofp_header const&
+    {
+      return multipart_.header;
+    }
+
+    auto length() const noexcept
+      -> std::uint16_t
+    {
+      return multipart_.header.length;
+    }
+
+    auto xid() const noexcept
+      -> std::uint32_t
+    {
+      return multipart_.header.xid;
+    }
+
+    auto flags() const noexcept
+      -> std::uint16_t
+    {
+      return multipart_.flags;
+    }
+
+    auto begin() const noexcept
+      -> const_iterator
+    {
+      return const_iterator{body_first_};
+    }
+
+    auto end() const noexcept
+      -> const_iterator
+    {
+      return const_iterator{body_last_};
+    }
+
+    // number of elements, counted by decode
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return size_;
+    }
+
+    auto empty() const noexcept
+      -> bool
+    {
+      return size_ == 0;
+    }
+
+    auto body_data() const noexcept
+      -> range_type
+    {
+      return range_type{body_first_, body_last_};
+    }
+
+    static auto decode(unsigned char const*& first, unsigned char const* last)
+      -> flow_stats_reply_view
+    {
+      if (std::size_t(std::distance(first, last)) < sizeof(ofp_type)) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for flow_stats_reply"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const multipart = detail::decode<ofp_type>(first, last);
+      if (multipart.header.version != flow_stats_reply::version()) {
+        throw exception{
+            protocol::bad_request_code::bad_version
+          , "invalid version"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      if (multipart.header.type != flow_stats_reply::type()) {
+        throw exception{
+            protocol::bad_request_code::bad_type
+          , "invalid message type"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      if (auto const error_msg
+          = flow_stats_reply::validate_header(multipart.header)) {
+        throw exception{protocol::bad_request_code::bad_len, error_msg}
+          << CANARD_NET_OFP_ERROR_INFO();
+      }
+      if (auto const error_msg
+          = flow_stats_reply::validate_header(multipart)) {
+        throw exception{protocol::bad_request_code::bad_len, error_msg}
+          << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const body_length
+        = std::size_t(multipart.header.length - sizeof(ofp_type));
+      if (std::size_t(std::distance(first, last)) < body_length) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for flow_stats_reply"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const body_first = first;
+      auto const body_last = first + body_length;
+
+      auto size = std::size_t{0};
+      for (auto it = body_first; it != body_last; ++size) {
+        auto const rest_length = std::size_t(body_last - it);
+        if (rest_length < sizeof(std::uint16_t)) {
+          throw exception{
+              protocol::bad_request_code::bad_len
+            , "too small data size for flow_stats"
+          } << CANARD_NET_OFP_ERROR_INFO();
+        }
+        auto const length = std::size_t(it[0] << 8 | it[1]);
+        if (length < flow_stats_view::base_size) {
+          throw exception{
+              exception::ex_error_type::bad_multipart_element
+            , exception::ex_error_code::bad_length
+            , "too small flow_stats length"
+          } << CANARD_NET_OFP_ERROR_INFO();
+        }
+        if (rest_length < length) {
+          throw exception{
+              protocol::bad_request_code::bad_len
+            , "too small data size for flow_stats"
+          } << CANARD_NET_OFP_ERROR_INFO();
+        }
+        it += length;
+      }
+
+      first = body_last;
+      return flow_stats_reply_view{multipart, body_first, body_last, size};
+    }
+
+  private:
+    flow_stats_reply_view(
+          ofp_type const& multipart
+        , unsigned char const* const body_first
+        , unsigned char const* const body_last
+        , std::size_t const size) noexcept
+      : multipart_(multipart)
+      , body_first_(body_first)
+      , body_last_(body_last)
+      , size_(size)
+    {
+    }
+
+  private:
+    ofp_type multipart_;
+    unsigned char const* body_first_;
+    unsigned char const* body_last_;
+    std::size_t size_;
+  };
+
 } // namespace multipart
 } // namespace messages
 } // namespace v13
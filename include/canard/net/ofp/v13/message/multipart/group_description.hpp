@@ -11,7 +11,9 @@
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/common/bucket.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -28,6 +30,14 @@ namespace multipart {
   public:
     using ofp_type = protocol::ofp_group_desc;
     using buckets_type = ofp::list<v13::bucket>;
+    using header_type = std::uint16_t;
+
+    static constexpr auto byte_length_from_header(
+        header_type const length) noexcept
+      -> std::uint16_t
+    {
+      return length;
+    }
 
     group_description(
           std::uint32_t const group_id
@@ -45,7 +55,7 @@ namespace multipart {
 
     group_description(group_description const&) = default;
 
-    group_description(group_description&& other)
+    group_description(group_description&& other) noexcept
       : group_desc_(other.group_desc_)
       , buckets_(other.extract_buckets())
     {
@@ -98,8 +108,8 @@ namespace multipart {
     auto extract_buckets()
       -> buckets_type
     {
-      auto buckets = buckets_type{};
-      buckets.swap(buckets_);
+      auto buckets = std::move(buckets_);
+      buckets_.clear();
       group_desc_.length = sizeof(ofp_type);
       return buckets;
     }
@@ -123,28 +133,41 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> group_description
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<group_description>
     {
       auto const group_desc = detail::decode<ofp_type>(first, last);
       if (group_desc.length < sizeof(ofp_type)) {
-        throw v13::exception{
+        return Policy::template error<group_description>(decode_error{
             v13::exception::ex_error_type::bad_multipart_element
           , v13::exception::ex_error_code::bad_length
           , "too small group_description length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const buckets_length
         = std::uint16_t(group_desc.length - sizeof(ofp_type));
       if (std::distance(first, last) < buckets_length) {
-        throw v13::exception{
+        return Policy::template error<group_description>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for group_description"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, buckets_length);
 
-      auto buckets = buckets_type::decode(first, last);
+      auto buckets = buckets_type::decode(first, last, policy);
+      if (Policy::failed(buckets)) {
+        return Policy::template error<group_description>(
+            Policy::error_of(buckets));
+      }
 
-      return group_description{group_desc, std::move(buckets)};
+      return group_description{
+        group_desc, std::move(Policy::value_of(buckets))
+      };
     }
 
     auto equal_impl(group_description const& rhs) const noexcept
@@ -10,7 +10,9 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -139,7 +141,7 @@ namespace multipart {
       return *this;
     }
 
-    void swap(group_stats& other) noexcept
+    void swap(group_stats& other)
     {
       std::swap(group_stats_, other.group_stats_);
       bucket_stats_.swap(other.bucket_stats_);
@@ -196,8 +198,8 @@ namespace multipart {
     auto extract_bucket_stats() noexcept
       -> bucket_stats_type
     {
-      auto bucket_stats = bucket_stats_type{};
-      bucket_stats.swap(bucket_stats_);
+      auto bucket_stats = std::move(bucket_stats_);
+      bucket_stats_.clear();
       group_stats_.length = sizeof(ofp_type);
       return bucket_stats;
     }
@@ -222,28 +224,39 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> group_stats
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<group_stats>
     {
       auto const stats = detail::decode<ofp_type>(first, last);
       if (stats.length < sizeof(ofp_type)) {
-        throw v13::exception{
+        return Policy::template error<group_stats>(decode_error{
             v13::exception::ex_error_type::bad_multipart_element
           , v13::exception::ex_error_code::bad_length
           , "too small group_stats length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const bucket_stats_length
         = std::uint16_t(stats.length - sizeof(ofp_type));
       if (std::distance(first, last) < bucket_stats_length) {
-        throw v13::exception{
+        return Policy::template error<group_stats>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for group_stats"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, bucket_stats_length);
 
-      auto bucket_stats = bucket_stats_type::decode(first, last);
+      auto bucket_stats = bucket_stats_type::decode(first, last, policy);
+      if (Policy::failed(bucket_stats)) {
+        return Policy::template error<group_stats>(
+            Policy::error_of(bucket_stats));
+      }
 
-      return group_stats{stats, std::move(bucket_stats)};
+      return group_stats{stats, std::move(Policy::value_of(bucket_stats))};
     }
 
     auto equal_impl(group_stats const& rhs) const noexcept
@@ -11,8 +11,10 @@
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
 #include <canard/net/ofp/v13/any_meter_band.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -29,6 +31,14 @@ namespace multipart {
   public:
     using ofp_type = protocol::ofp_meter_config;
     using bands_type = ofp::list<v13::any_meter_band>;
+    using header_type = std::uint16_t;
+
+    static constexpr auto byte_length_from_header(
+        header_type const length) noexcept
+      -> std::uint16_t
+    {
+      return length;
+    }
 
     meter_config(
           std::uint32_t const meter_id
@@ -98,8 +108,8 @@ namespace multipart {
     auto extract_bands() noexcept
       -> bands_type
     {
-      auto bands = bands_type{};
-      bands.swap(bands_);
+      auto bands = std::move(bands_);
+      bands_.clear();
       meter_config_.length = sizeof(ofp_type);
       return bands;
     }
@@ -123,27 +133,37 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> meter_config
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<meter_config>
     {
       auto const config = detail::decode<ofp_type>(first, last);
       if (config.length < sizeof(ofp_type)) {
-        throw v13::exception{
+        return Policy::template error<meter_config>(decode_error{
             v13::exception::ex_error_type::bad_multipart_element
           , v13::exception::ex_error_code::bad_length
           , "too small meter_config length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const bands_length = std::uint16_t(config.length - sizeof(ofp_type));
       if (std::distance(first, last) < bands_length) {
-        throw v13::exception{
+        return Policy::template error<meter_config>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for meter_config"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, bands_length);
 
-      auto bands = bands_type::decode(first, last);
+      auto bands = bands_type::decode(first, last, policy);
+      if (Policy::failed(bands)) {
+        return Policy::template error<meter_config>(Policy::error_of(bands));
+      }
 
-      return meter_config{config, std::move(bands)};
+      return meter_config{config, std::move(Policy::value_of(bands))};
     }
 
     auto equal_impl(meter_config const& other) const noexcept
@@ -9,8 +9,10 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -135,7 +137,7 @@ namespace multipart {
       return operator=(meter_stats{other});
     }
 
-    auto operator=(meter_stats&& other) noexcept
+    auto operator=(meter_stats&& other)
       -> meter_stats&
     {
       auto tmp = std::move(other);
@@ -143,7 +145,7 @@ namespace multipart {
       return *this;
     }
 
-    void swap(meter_stats& other) noexcept
+    void swap(meter_stats& other)
     {
       std::swap(meter_stats_, other.meter_stats_);
       band_stats_.swap(other.band_stats_);
@@ -200,8 +202,8 @@ namespace multipart {
     auto extract_band_stats() noexcept
       -> band_stats_type
     {
-      auto band_stats = band_stats_type{};
-      band_stats.swap(band_stats_);
+      auto band_stats = std::move(band_stats_);
+      band_stats_.clear();
       meter_stats_.len = sizeof(ofp_type);
       return band_stats;
     }
@@ -226,27 +228,38 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> meter_stats
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<meter_stats>
     {
       auto const stats = detail::decode<ofp_type>(first, last);
       if (stats.len < sizeof(ofp_type)) {
-        throw v13::exception{
+        return Policy::template error<meter_stats>(decode_error{
             v13::exception::ex_error_type::bad_multipart_element
           , v13::exception::ex_error_code::bad_length
           , "too small meter_stats length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const band_stats_length
         = std::uint16_t(stats.len - sizeof(ofp_type));
       if (std::distance(first, last) < band_stats_length) {
-        throw v13::exception{
+        return Policy::template error<meter_stats>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for meter_stats"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       last = std::next(first, band_stats_length);
 
-      auto band_stats = band_stats_type::decode(first, last);
-      return meter_stats{stats, std::move(band_stats)};
+      auto band_stats = band_stats_type::decode(first, last, policy);
+      if (Policy::failed(band_stats)) {
+        return Policy::template error<meter_stats>(
+            Policy::error_of(band_stats));
+      }
+      return meter_stats{stats, std::move(Policy::value_of(band_stats))};
     }
 
     auto equal_impl(meter_stats const& rhs) const noexcept
@@ -14,8 +14,10 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/list.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_multipart.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/utility/table_feature_property_set.hpp>
@@ -33,6 +35,14 @@ namespace multipart {
   public:
     using ofp_type = protocol::ofp_table_features;
     using properties_type = ofp::list<any_table_feature_property>;
+    using header_type = std::uint16_t;
+
+    static constexpr auto byte_length_from_header(
+        header_type const length) noexcept
+      -> std::uint16_t
+    {
+      return length;
+    }
 
     table_features(
           std::uint8_t const table_id
@@ -77,7 +87,7 @@ namespace multipart {
 
     table_features(table_features const&) = default;
 
-    table_features(table_features&& other)
+    table_features(table_features&& other) noexcept
       : table_features_(other.table_features_)
       , properties_(other.extract_properties())
     {
@@ -149,8 +159,8 @@ namespace multipart {
     auto extract_properties()
       -> properties_type
     {
-      auto properties = properties_type{};
-      properties.swap(properties_);
+      auto properties = std::move(properties_);
+      properties_.clear();
       table_features_.length = min_length();
       return properties;
     }
@@ -174,27 +184,38 @@ namespace multipart {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> table_features
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<table_features>
     {
       auto const features = detail::decode<ofp_type>(first, last);
       if (features.length < min_length()) {
-        throw exception{
+        return Policy::template error<table_features>(decode_error{
             exception::ex_error_type::bad_multipart_element
           , exception::ex_error_code::bad_length
           , "too small table_features length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
       auto const prop_length
         = std::uint16_t(features.length - sizeof(ofp_type));
       if (std::distance(first, last) < prop_length) {
-        throw exception{
+        return Policy::template error<table_features>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for table_features"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       last = std::next(first, prop_length);
-      auto properties = properties_type::decode(first, last);
-      return table_features{features, std::move(properties)};
+      auto properties = properties_type::decode(first, last, policy);
+      if (Policy::failed(properties)) {
+        return Policy::template error<table_features>(
+            Policy::error_of(properties));
+      }
+      return table_features{features, std::move(Policy::value_of(properties))};
     }
 
     auto equal_impl(table_features const& rhs) const noexcept
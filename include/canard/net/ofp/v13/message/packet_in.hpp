@@ -1,10 +1,12 @@
 #ifndef CANARD_NET_OFP_V13_MESSAGES_PACKET_IN_HPP
 #define CANARD_NET_OFP_V13_MESSAGES_PACKET_IN_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <stdexcept>
 #include <utility>
-#include <boost/range/algorithm/find_if.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <canard/net/ofp/data_type.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
@@ -13,8 +15,11 @@
 #include <canard/net/ofp/detail/padding.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/common/oxm_match_view.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/detail/length_utility.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
@@ -25,6 +30,152 @@ namespace ofp {
 namespace v13 {
 namespace messages {
 
+  class packet_in_view
+  {
+    static constexpr std::uint16_t data_alignment_padding_size = 2;
+    static constexpr std::uint16_t base_pkt_in_size
+      = sizeof(protocol::ofp_packet_in)
+      + oxm_match::min_byte_length()
+      + data_alignment_padding_size;
+
+  public:
+    using ofp_type = protocol::ofp_packet_in;
+    using range_type = boost::iterator_range<unsigned char const*>;
+
+    static constexpr protocol::ofp_type message_type
+      = protocol::OFPT_PACKET_IN;
+
+    auto header() const noexcept
+      -> protocol::ofp_header const&
+    {
+      return packet_in_.header;
+    }
+
+    auto length() const noexcept
+      -> std::uint16_t
+    {
+      return packet_in_.header.length;
+    }
+
+    auto xid() const noexcept
+      -> std::uint32_t
+    {
+      return packet_in_.header.xid;
+    }
+
+    auto buffer_id() const noexcept
+      -> std::uint32_t
+    {
+      return packet_in_.buffer_id;
+    }
+
+    auto total_length() const noexcept
+      -> std::uint16_t
+    {
+      return packet_in_.total_len;
+    }
+
+    auto in_port() const
+      -> std::uint32_t
+    {
+      auto const in_port = match_.find<oxm_match_fields::in_port>();
+      if (!in_port) {
+        throw std::out_of_range{"no in_port in packet_in match"};
+      }
+      return in_port->oxm_value();
+    }
+
+    auto reason() const noexcept
+      -> protocol::ofp_packet_in_reason
+    {
+      return protocol::ofp_packet_in_reason(packet_in_.reason);
+    }
+
+    auto table_id() const noexcept
+      -> std::uint8_t
+    {
+      return packet_in_.table_id;
+    }
+
+    auto cookie() const noexcept
+      -> std::uint64_t
+    {
+      return packet_in_.cookie;
+    }
+
+    auto match() const noexcept
+      -> oxm_match_view const&
+    {
+      return match_;
+    }
+
+    auto frame() const noexcept
+      -> range_type
+    {
+      return range_type{frame_first_, frame_last_};
+    }
+
+    auto frame_length() const noexcept
+      -> std::uint16_t
+    {
+      return frame_last_ - frame_first_;
+    }
+
+    static constexpr auto is_valid_message_length(
+        protocol::ofp_header const& header) noexcept
+      -> bool
+    {
+      return header.length >= base_pkt_in_size;
+    }
+
+    static auto decode(unsigned char const*& first, unsigned char const* last)
+      -> packet_in_view
+    {
+      if (std::size_t(std::distance(first, last)) < sizeof(ofp_type)) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for packet_in"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+      auto const pkt_in = detail::decode<ofp_type>(first, last);
+      auto const rest_size = pkt_in.header.length - sizeof(ofp_type);
+      if (!is_valid_message_length(pkt_in.header)
+          || std::size_t(std::distance(first, last)) < rest_size) {
+        throw exception{
+            protocol::bad_request_code::bad_len
+          , "too small data size for packet_in"
+        } << CANARD_NET_OFP_ERROR_INFO();
+      }
+
+      auto const match = oxm_match_view::decode(
+          first, first + rest_size - data_alignment_padding_size);
+      first += data_alignment_padding_size;
+      auto const frame_first = first;
+      first += rest_size - match.byte_length() - data_alignment_padding_size;
+
+      return packet_in_view{pkt_in, match, frame_first, first};
+    }
+
+  private:
+    packet_in_view(
+          ofp_type const& pkt_in
+        , oxm_match_view const& match
+        , unsigned char const* const frame_first
+        , unsigned char const* const frame_last) noexcept
+      : packet_in_(pkt_in)
+      , match_(match)
+      , frame_first_(frame_first)
+      , frame_last_(frame_last)
+    {
+    }
+
+  private:
+    ofp_type packet_in_;
+    oxm_match_view match_;
+    unsigned char const* frame_first_;
+    unsigned char const* frame_last_;
+  };
+
   class packet_in
     : public detail::v13::basic_message<packet_in>
   {
@@ -88,6 +239,20 @@ namespace messages {
     {
     }
 
+    explicit packet_in(packet_in_view const& view)
+      : packet_in_{
+            view.header()
+          , view.buffer_id()
+          , view.total_length()
+          , std::uint8_t(view.reason())
+          , view.table_id()
+          , view.cookie()
+        }
+      , match_(view.match().to_oxm_match())
+      , data_(view.frame().begin(), view.frame().end())
+    {
+    }
+
     packet_in(packet_in const&) = default;
 
     packet_in(packet_in&& other) noexcept
@@ -104,7 +269,7 @@ namespace messages {
       return operator=(packet_in{other});
     }
 
-    auto operator=(packet_in&& other) noexcept
+    auto operator=(packet_in&& other)
       -> packet_in&
     {
       auto pkt_in = std::move(other);
@@ -135,12 +300,7 @@ namespace messages {
     auto in_port() const
       -> std::uint32_t
     {
-      using in_port = oxm_match_fields::in_port;
-      auto const it = boost::find_if(
-            match_.oxm_fields()
-          , [](oxm_match::oxm_fields_type::const_reference v)
-            { return v.type() == in_port::oxm_type(); });
-      return v13::any_cast<in_port>(*it).oxm_value();
+      return match_.get<oxm_match_fields::in_port>().oxm_value();
     }
 
     auto reason() const noexcept
@@ -170,8 +330,7 @@ namespace messages {
     auto extract_match()
       -> oxm_match
     {
-      auto match = oxm_match{};
-      match.swap(match_);
+      auto match = std::move(match_);
       packet_in_.header.length = base_pkt_in_size + data_.size();
       return match;
     }
@@ -191,8 +350,8 @@ namespace messages {
     auto extract_frame() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       packet_in_.header.length -= data.size();
       return data;
     }
@@ -225,28 +384,40 @@ namespace messages {
       match_.encode(container);
       detail::encode_byte_array(
           container, detail::padding, data_alignment_padding_size);
-      detail::encode_byte_array(container, data_.data(), data_.size());
+      detail::encode_payload(container, data_.data(), data_.size());
     }
 
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> packet_in
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<packet_in>
     {
       auto const pkt_in = detail::decode<ofp_type>(first, last);
       auto const rest_size = pkt_in.header.length - sizeof(ofp_type);
 
       auto const ofp_match
         = detail::decode_without_consumption<protocol::ofp_match>(first, last);
-      oxm_match::validate_header(ofp_match);
+      if (auto const error = oxm_match::try_validate_header(ofp_match)) {
+        return Policy::template error<packet_in>(error);
+      }
       auto const match_length = detail::v13::exact_length(ofp_match.length);
       if (rest_size - data_alignment_padding_size < match_length) {
-        throw exception{
+        return Policy::template error<packet_in>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for oxm_match"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
-      auto match = oxm_match::decode(first, last);
+      auto match = oxm_match::decode(first, last, policy);
+      if (Policy::failed(match)) {
+        return Policy::template error<packet_in>(Policy::error_of(match));
+      }
 
       std::advance(first, data_alignment_padding_size);
 
@@ -254,7 +425,9 @@ namespace messages {
         = rest_size - match_length - data_alignment_padding_size;
       auto data = ofp::decode_data(first, data_length);
 
-      return packet_in{pkt_in, std::move(match), std::move(data)};
+      return packet_in{
+        pkt_in, std::move(Policy::value_of(match)), std::move(data)
+      };
     }
 
     auto equal_impl(packet_in const& rhs) const noexcept
@@ -10,8 +10,10 @@
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/get_xid.hpp>
 #include <canard/net/ofp/v13/action_list.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -83,7 +85,7 @@ namespace messages {
 
     packet_out(packet_out const&) = default;
 
-    packet_out(packet_out&& other)
+    packet_out(packet_out&& other) noexcept
       : packet_out_(other.packet_out_)
       , actions_(other.extract_actions())
       , data_(std::move(other.data_))
@@ -140,8 +142,8 @@ namespace messages {
     auto extract_actions()
       -> action_list
     {
-      auto actions = action_list{};
-      actions.swap(actions_);
+      auto actions = std::move(actions_);
+      actions_.clear();
       packet_out_.header.length -= packet_out_.actions_len;
       packet_out_.actions_len = 0;
       return actions;
@@ -156,8 +158,8 @@ namespace messages {
     auto extract_frame() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       packet_out_.header.length -= data.size();
       return data;
     }
@@ -187,29 +189,41 @@ namespace messages {
     {
       detail::encode(container, packet_out_);
       actions_.encode(container);
-      detail::encode_byte_array(container, data_.data(), data_.size());
+      detail::encode_payload(container, data_.data(), data_.size());
     }
 
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> packet_out
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<packet_out>
     {
       auto const pkt_out = detail::decode<ofp_type>(first, last);
       auto const rest_size = pkt_out.header.length - sizeof(ofp_type);
       if (rest_size < pkt_out.actions_len) {
-        throw exception{
+        return Policy::template error<packet_out>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for actions"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       auto const actions_last = std::next(first, pkt_out.actions_len);
-      auto actions = action_list::decode(first, actions_last);
+      auto actions = action_list::decode(first, actions_last, policy);
+      if (Policy::failed(actions)) {
+        return Policy::template error<packet_out>(Policy::error_of(actions));
+      }
 
       auto const data_length = rest_size - pkt_out.actions_len;
       auto data = ofp::decode_data(first, data_length);
 
-      return packet_out{pkt_out, std::move(actions), std::move(data)};
+      return packet_out{
+        pkt_out, std::move(Policy::value_of(actions)), std::move(data)
+      };
     }
 
     auto equal_impl(packet_out const& rhs) const noexcept
@@ -13,6 +13,7 @@
 #include <canard/net/ofp/v13/detail/basic_fixed_length_message.hpp>
 #include <canard/net/ofp/v13/detail/basic_message.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
 namespace canard {
@@ -100,7 +101,7 @@ namespace messages {
 
     queue_get_config_reply(queue_get_config_reply const&) = default;
 
-    queue_get_config_reply(queue_get_config_reply&& other)
+    queue_get_config_reply(queue_get_config_reply&& other) noexcept
       : queue_get_config_reply_(other.queue_get_config_reply_)
       , queues_(other.extract_queues())
     {
@@ -142,8 +143,8 @@ namespace messages {
     auto extract_queues()
       -> queues_type
     {
-      auto queues = queues_type{};
-      queues.swap(queues_);
+      auto queues = std::move(queues_);
+      queues_.clear();
       queue_get_config_reply_.header.length = min_length();
       return queues;
     }
@@ -172,6 +173,13 @@ namespace messages {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> queue_get_config_reply
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+      -> typename Policy::template result_type<queue_get_config_reply>
     {
       auto const queue_get_config = detail::decode<ofp_type>(first, last);
 
@@ -179,9 +187,15 @@ namespace messages {
         = queue_get_config.header.length - sizeof(ofp_type);
       last = std::next(first, queues_length);
 
-      auto queues = queues_type::decode(first, last);
+      auto queues = queues_type::decode(first, last, policy);
+      if (Policy::failed(queues)) {
+        return Policy::template error<queue_get_config_reply>(
+            Policy::error_of(queues));
+      }
 
-      return queue_get_config_reply{queue_get_config, std::move(queues)};
+      return queue_get_config_reply{
+        queue_get_config, std::move(Policy::value_of(queues))
+      };
     }
 
     auto equal_impl(queue_get_config_reply const& rhs) const noexcept
@@ -42,6 +42,23 @@ namespace v13 {
     , messages::get_async_reply
   >;
 
+  using default_controller_message_list = std::tuple<
+      messages::error
+    , messages::echo_request
+    , messages::echo_reply
+    , messages::features_request
+    , messages::get_config_request
+    , messages::set_config
+    , messages::packet_out
+    , messages::port_mod
+    , messages::table_mod
+    , messages::barrier_request
+    , messages::queue_get_config_request
+    , messages::role_request
+    , messages::get_async_request
+    , messages::set_async
+  >;
+
   using default_multipart_reply_list = std::tuple<
       messages::multipart::description_reply
     , messages::multipart::flow_stats_reply
@@ -59,6 +76,23 @@ namespace v13 {
     , messages::multipart::port_description_reply
   >;
 
+  using default_multipart_request_list = std::tuple<
+      messages::multipart::description_request
+    , messages::multipart::flow_stats_request
+    , messages::multipart::aggregate_stats_request
+    , messages::multipart::table_stats_request
+    , messages::multipart::port_stats_request
+    , messages::multipart::queue_stats_request
+    , messages::multipart::group_stats_request
+    , messages::multipart::group_description_request
+    , messages::multipart::group_features_request
+    , messages::multipart::meter_stats_request
+    , messages::multipart::meter_config_request
+    , messages::multipart::meter_features_request
+    , messages::multipart::table_features_request
+    , messages::multipart::port_description_request
+  >;
+
 } // namespace v13
 } // namespace ofp
 } // namespace net
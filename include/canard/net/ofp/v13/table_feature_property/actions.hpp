@@ -13,6 +13,7 @@
 #include <canard/net/ofp/type_traits/is_all_constructible.hpp>
 #include <canard/net/ofp/v13/detail/basic_table_feature_property.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/table_feature_property/id/action_id.hpp>
 
@@ -64,7 +65,7 @@ namespace table_feature_properties {
 
       basic_prop_actions(basic_prop_actions const&) = default;
 
-      basic_prop_actions(basic_prop_actions&& other)
+      basic_prop_actions(basic_prop_actions&& other) noexcept
         : table_feature_prop_actions_(other.table_feature_prop_actions_)
         , action_ids_(other.extract_action_ids())
       {
@@ -100,8 +101,8 @@ namespace table_feature_properties {
       auto extract_action_ids()
         -> action_ids_type
       {
-        auto action_ids = action_ids_type{};
-        action_ids.swap(action_ids_);
+        auto action_ids = std::move(action_ids_);
+        action_ids_.clear();
         table_feature_prop_actions_.length = sizeof(ofp_type);
         return action_ids;
       }
@@ -136,13 +137,23 @@ namespace table_feature_properties {
       template <class Iterator>
       static auto decode_impl(Iterator& first, Iterator last)
         -> T
+      {
+        return decode_impl(first, last, detail::v13::throw_decode_error{});
+      }
+
+      template <class Iterator, class Policy>
+      static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+        -> typename Policy::template result_type<T>
       {
         auto const property = detail::decode<ofp_type>(first, last);
 
         last = std::next(first, property.length - sizeof(ofp_type));
-        auto action_ids = action_ids_type::decode(first, last);
+        auto action_ids = action_ids_type::decode(first, last, policy);
+        if (Policy::failed(action_ids)) {
+          return Policy::template error<T>(Policy::error_of(action_ids));
+        }
 
-        return T{property, std::move(action_ids)};
+        return T{property, std::move(Policy::value_of(action_ids))};
       }
 
       auto equal_impl(T const& rhs) const noexcept
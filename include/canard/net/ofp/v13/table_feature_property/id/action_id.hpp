@@ -9,7 +9,9 @@
 #include <canard/net/ofp/detail/basic_protocol_type.hpp>
 #include <canard/net/ofp/detail/decode.hpp>
 #include <canard/net/ofp/detail/encode.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -56,7 +58,7 @@ namespace v13 {
     auto operator=(action_id const&)
       -> action_id& = default;
 
-    auto operator=(action_id&& other) noexcept
+    auto operator=(action_id&& other)
       -> action_id&
     {
       auto tmp = std::move(other);
@@ -98,8 +100,8 @@ namespace v13 {
     auto extract_data() noexcept
       -> data_type
     {
-      auto data = data_type{};
-      data.swap(data_);
+      auto data = std::move(data_);
+      data_.clear();
       action_header_.len -= data.size();
       return data;
     }
@@ -136,30 +138,37 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> action_id
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy)
+      -> typename Policy::template result_type<action_id>
     {
       auto header = detail::decode<ofp_exp_type>(
           first, last, detail::copy_size<base_size>{});
       if (header.len < base_size) {
-        throw exception{
+        return Policy::template error<action_id>(decode_error{
             protocol::table_features_failed_code::bad_len
           , "too small action_id length"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       auto rest_size = std::uint16_t(header.len - base_size);
       if (std::distance(first, last) < rest_size) {
-        throw exception{
+        return Policy::template error<action_id>(decode_error{
             protocol::bad_request_code::bad_len
           , "too small data size for action_id"
-        } << CANARD_NET_OFP_ERROR_INFO();
+        });
       }
 
       if (header.type == protocol::OFPAT_EXPERIMENTER) {
         if (rest_size < sizeof(header.experimenter)) {
-          throw exception{
+          return Policy::template error<action_id>(decode_error{
               protocol::bad_request_code::bad_len
             , "too small data size for action_id with experimenter id"
-          } << CANARD_NET_OFP_ERROR_INFO();
+          });
         }
         header.experimenter = detail::decode<std::uint32_t>(first, last);
         rest_size -= sizeof(header.experimenter);
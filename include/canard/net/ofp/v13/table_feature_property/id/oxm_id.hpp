@@ -8,7 +8,9 @@
 #include <canard/net/ofp/detail/encode.hpp>
 #include <canard/net/ofp/detail/memcmp.hpp>
 #include <canard/net/ofp/v13/common/oxm_header.hpp>
+#include <canard/net/ofp/v13/decode_result.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/exception.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 
@@ -131,15 +133,22 @@ namespace v13 {
     template <class Iterator>
     static auto decode_impl(Iterator& first, Iterator last)
       -> oxm_id
+    {
+      return decode_impl(first, last, detail::v13::throw_decode_error{});
+    }
+
+    template <class Iterator, class Policy>
+    static auto decode_impl(Iterator& first, Iterator last, Policy)
+      -> typename Policy::template result_type<oxm_id>
     {
       auto const header = detail::decode<ofp_type>(first, last);
       auto experimenter_id = std::uint32_t{0};
       if (oxm_header_ops::oxm_class(header) == protocol::OFPXMC_EXPERIMENTER) {
         if (std::distance(first, last) < sizeof(experimenter_id)) {
-          throw exception{
+          return Policy::template error<oxm_id>(decode_error{
               protocol::bad_request_code::bad_len
             , "too small data size for oxm_id with experimenter id"
-          } << CANARD_NET_OFP_ERROR_INFO();
+          });
         }
         experimenter_id = detail::decode<std::uint32_t>(first, last);
       }
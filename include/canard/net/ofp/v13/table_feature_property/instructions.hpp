@@ -13,6 +13,7 @@
 #include <canard/net/ofp/type_traits/is_all_constructible.hpp>
 #include <canard/net/ofp/v13/detail/basic_table_feature_property.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/table_feature_property/id/instruction_id.hpp>
 
@@ -66,7 +67,7 @@ namespace table_feature_properties {
 
       basic_prop_instructions(basic_prop_instructions const&) = default;
 
-      basic_prop_instructions(basic_prop_instructions&& other)
+      basic_prop_instructions(basic_prop_instructions&& other) noexcept
         : table_feature_prop_instructions_(
             other.table_feature_prop_instructions_)
         , instruction_ids_(other.extract_instruction_ids())
@@ -105,8 +106,8 @@ namespace table_feature_properties {
       auto extract_instruction_ids()
         -> instruction_ids_type
       {
-        auto instruction_ids = instruction_ids_type{};
-        instruction_ids.swap(instruction_ids_);
+        auto instruction_ids = std::move(instruction_ids_);
+        instruction_ids_.clear();
         table_feature_prop_instructions_.length = sizeof(ofp_type);
         return instruction_ids;
       }
@@ -142,13 +143,23 @@ namespace table_feature_properties {
       template <class Iterator>
       static auto decode_impl(Iterator& first, Iterator last)
         -> T
+      {
+        return decode_impl(first, last, detail::v13::throw_decode_error{});
+      }
+
+      template <class Iterator, class Policy>
+      static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+        -> typename Policy::template result_type<T>
       {
         auto const property = detail::decode<ofp_type>(first, last);
 
         last = std::next(first, property.length - sizeof(ofp_type));
-        auto ids = instruction_ids_type::decode(first, last);
+        auto ids = instruction_ids_type::decode(first, last, policy);
+        if (Policy::failed(ids)) {
+          return Policy::template error<T>(Policy::error_of(ids));
+        }
 
-        return T{property, std::move(ids)};
+        return T{property, std::move(Policy::value_of(ids))};
       }
 
       auto equal_impl(T const& rhs) const noexcept
@@ -59,7 +59,7 @@ namespace table_feature_properties {
 
       basic_prop_next_tables(basic_prop_next_tables const&) = default;
 
-      basic_prop_next_tables(basic_prop_next_tables&& other)
+      basic_prop_next_tables(basic_prop_next_tables&& other) noexcept
         : table_feature_prop_next_tables_(other.table_feature_prop_next_tables_)
         , next_table_ids_(other.extract_next_table_ids())
       {
@@ -97,8 +97,8 @@ namespace table_feature_properties {
       auto extract_next_table_ids()
         -> next_table_ids_type
       {
-        auto next_table_ids = next_table_ids_type{};
-        next_table_ids.swap(next_table_ids_);
+        auto next_table_ids = std::move(next_table_ids_);
+        next_table_ids_.clear();
         table_feature_prop_next_tables_.length = sizeof(ofp_type);
         return next_table_ids;
       }
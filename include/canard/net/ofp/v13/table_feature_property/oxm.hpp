@@ -13,6 +13,7 @@
 #include <canard/net/ofp/type_traits/is_all_constructible.hpp>
 #include <canard/net/ofp/v13/detail/basic_table_feature_property.hpp>
 #include <canard/net/ofp/v13/detail/byteorder.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
 #include <canard/net/ofp/v13/openflow.hpp>
 #include <canard/net/ofp/v13/table_feature_property/id/oxm_id.hpp>
 
@@ -62,7 +63,7 @@ namespace table_feature_properties {
 
       basic_prop_oxm(basic_prop_oxm const&) = default;
 
-      basic_prop_oxm(basic_prop_oxm&& other)
+      basic_prop_oxm(basic_prop_oxm&& other) noexcept
         : table_feature_prop_oxm_(other.table_feature_prop_oxm_)
         , oxm_ids_(other.extract_oxm_ids())
       {
@@ -98,8 +99,8 @@ namespace table_feature_properties {
       auto extract_oxm_ids()
         -> oxm_ids_type
       {
-        auto oxm_ids = oxm_ids_type{};
-        oxm_ids.swap(oxm_ids_);
+        auto oxm_ids = std::move(oxm_ids_);
+        oxm_ids_.clear();
         table_feature_prop_oxm_.length = sizeof(ofp_type);
         return oxm_ids;
       }
@@ -133,13 +134,23 @@ namespace table_feature_properties {
       template <class Iterator>
       static auto decode_impl(Iterator& first, Iterator last)
         -> T
+      {
+        return decode_impl(first, last, detail::v13::throw_decode_error{});
+      }
+
+      template <class Iterator, class Policy>
+      static auto decode_impl(Iterator& first, Iterator last, Policy policy)
+        -> typename Policy::template result_type<T>
       {
         auto const property = detail::decode<ofp_type>(first, last);
 
         last = std::next(first, property.length - sizeof(ofp_type));
-        auto oxm_ids = oxm_ids_type::decode(first, last);
+        auto oxm_ids = oxm_ids_type::decode(first, last, policy);
+        if (Policy::failed(oxm_ids)) {
+          return Policy::template error<T>(Policy::error_of(oxm_ids));
+        }
 
-        return T{property, std::move(oxm_ids)};
+        return T{property, std::move(Policy::value_of(oxm_ids))};
       }
 
       auto equal_impl(T const& rhs) const noexcept
@@ -0,0 +1,27 @@
+#ifndef CANARD_NET_OFP_V13_TRY_DECODE_HPP
+#define CANARD_NET_OFP_V13_TRY_DECODE_HPP
+
+#include <canard/net/ofp/v13/decode_result.hpp>
+#include <canard/net/ofp/v13/detail/decode_policy.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  // Decodes T as T::decode does, but returns malformed input as a
+  // decode_error instead of throwing. Like T::decode, it expects the header
+  // of T to be checked already (e.g. by T::validate_header).
+  template <class T, class Iterator>
+  auto try_decode(Iterator& first, Iterator last)
+    -> decode_result<T>
+  {
+    return T::decode(first, last, detail::v13::return_decode_error{});
+  }
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_TRY_DECODE_HPP
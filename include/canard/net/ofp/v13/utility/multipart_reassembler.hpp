@@ -0,0 +1,230 @@
+#ifndef CANARD_NET_OFP_V13_MULTIPART_REASSEMBLER_HPP
+#define CANARD_NET_OFP_V13_MULTIPART_REASSEMBLER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <boost/optional/optional.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  // Joins the bodies of a multipart reply split by OFPMPF_REPLY_MORE.
+  //
+  // Reply is an array body multipart reply type, so a sequence is keyed by
+  // the xid of its messages. Elements are moved into a single list per
+  // sequence. A sequence is discarded when it exceeds the limits or when
+  // its next reply does not arrive within the timeout.
+  template <class Reply, class Clock = std::chrono::steady_clock>
+  class multipart_reassembler
+  {
+  public:
+    using reply_type = Reply;
+    using body_type = typename Reply::body_type;
+    using clock_type = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    struct aggregate_type
+    {
+      std::uint32_t xid;
+      body_type body;
+    };
+
+    static constexpr std::size_t default_max_sequences = 64;
+    static constexpr std::size_t default_max_byte_length = 64 * 1024 * 1024;
+
+    explicit multipart_reassembler(
+          duration const timeout
+        , std::size_t const max_sequences = default_max_sequences
+        , std::size_t const max_byte_length = default_max_byte_length)
+      : timeout_(timeout)
+      , max_sequences_(max_sequences)
+      , max_byte_length_(max_byte_length)
+      , byte_length_(0)
+    {
+    }
+
+    static constexpr auto multipart_type() noexcept
+      -> protocol::ofp_multipart_type
+    {
+      return Reply::multipart_type();
+    }
+
+    // number of incomplete sequences
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return sequences_.size();
+    }
+
+    auto empty() const noexcept
+      -> bool
+    {
+      return sequences_.empty();
+    }
+
+    // total length of the elements held for incomplete sequences
+    auto byte_length() const noexcept
+      -> std::size_t
+    {
+      return byte_length_;
+    }
+
+    auto contains(std::uint32_t const xid) const
+      -> bool
+    {
+      return sequences_.find(xid) != sequences_.end();
+    }
+
+    // Reserves space for the expected number of elements of the sequence,
+    // such as the flow count of an aggregate stats reply, before its first
+    // reply arrives.
+    void reserve(
+          std::uint32_t const xid, std::size_t const num_elements
+        , time_point const now = clock_type::now())
+    {
+      find_or_start(xid, now).body.reserve(num_elements);
+    }
+
+    // Returns the joined body when the reply is the last of its sequence.
+    // Throws std::length_error after discarding the sequence if it would
+    // exceed the limits.
+    auto push(Reply&& reply, time_point const now = clock_type::now())
+      -> boost::optional<aggregate_type>
+    {
+      auto const xid = reply.xid();
+      auto const more = reply.flags() & protocol::OFPMPF_REPLY_MORE;
+      auto body = reply.extract_body();
+
+      auto it = sequences_.find(xid);
+      if (it == sequences_.end()) {
+        if (!more) {
+          return aggregate_type{xid, std::move(body)};
+        }
+        it = start(xid, now);
+      }
+      else {
+        it->second.deadline = now + timeout_;
+      }
+
+      if (byte_length_ + body.byte_length() > max_byte_length_) {
+        erase(it);
+        throw std::length_error{"too large multipart sequence"};
+      }
+      byte_length_ += body.byte_length();
+      append(it->second.body, std::move(body));
+
+      if (more) {
+        return boost::none;
+      }
+      byte_length_ -= it->second.body.byte_length();
+      auto aggregate = aggregate_type{xid, std::move(it->second.body)};
+      sequences_.erase(it);
+      return aggregate;
+    }
+
+    // Discards the sequences which have received no reply within the
+    // timeout and returns their number.
+    auto expire(time_point const now = clock_type::now())
+      -> std::size_t
+    {
+      auto num_expired = std::size_t{0};
+      for (auto it = sequences_.begin(); it != sequences_.end(); ) {
+        if (it->second.deadline <= now) {
+          it = erase(it);
+          ++num_expired;
+        }
+        else {
+          ++it;
+        }
+      }
+      return num_expired;
+    }
+
+    auto abort(std::uint32_t const xid)
+      -> bool
+    {
+      auto const it = sequences_.find(xid);
+      if (it == sequences_.end()) {
+        return false;
+      }
+      erase(it);
+      return true;
+    }
+
+    void clear() noexcept
+    {
+      sequences_.clear();
+      byte_length_ = 0;
+    }
+
+  private:
+    struct sequence
+    {
+      body_type body;
+      time_point deadline;
+    };
+
+    using sequence_map = std::unordered_map<std::uint32_t, sequence>;
+
+    auto start(std::uint32_t const xid, time_point const now)
+      -> typename sequence_map::iterator
+    {
+      if (sequences_.size() >= max_sequences_) {
+        throw std::length_error{"too many multipart sequences"};
+      }
+      return sequences_.emplace(xid, sequence{{}, now + timeout_}).first;
+    }
+
+    auto find_or_start(std::uint32_t const xid, time_point const now)
+      -> sequence&
+    {
+      auto const it = sequences_.find(xid);
+      return it != sequences_.end() ? it->second : start(xid, now)->second;
+    }
+
+    auto erase(typename sequence_map::iterator const it)
+      -> typename sequence_map::iterator
+    {
+      byte_length_ -= it->second.body.byte_length();
+      return sequences_.erase(it);
+    }
+
+    static void append(body_type& body, body_type&& elements)
+    {
+      if (body.empty() && body.capacity() < elements.size()) {
+        body.swap(elements);
+        return;
+      }
+      body.splice(body.cend(), elements);
+    }
+
+  private:
+    sequence_map sequences_;
+    duration timeout_;
+    std::size_t max_sequences_;
+    std::size_t max_byte_length_;
+    std::size_t byte_length_;
+  };
+
+  template <class Reply, class Clock>
+  constexpr std::size_t
+  multipart_reassembler<Reply, Clock>::default_max_sequences;
+
+  template <class Reply, class Clock>
+  constexpr std::size_t
+  multipart_reassembler<Reply, Clock>::default_max_byte_length;
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_MULTIPART_REASSEMBLER_HPP
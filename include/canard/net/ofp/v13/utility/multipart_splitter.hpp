@@ -0,0 +1,103 @@
+#ifndef CANARD_NET_OFP_V13_MULTIPART_SPLITTER_HPP
+#define CANARD_NET_OFP_V13_MULTIPART_SPLITTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <canard/net/ofp/get_xid.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  namespace multipart_splitter_detail {
+
+    template <class Message>
+    constexpr auto more_flag() noexcept
+      -> std::uint16_t
+    {
+      return Message::message_type == protocol::OFPT_MULTIPART_REQUEST
+        ? std::uint16_t(protocol::OFPMPF_REQ_MORE)
+        : std::uint16_t(protocol::OFPMPF_REPLY_MORE);
+    }
+
+  } // namespace multipart_splitter_detail
+
+  // Splits the body into array body multipart messages of the same xid,
+  // each of which holds as many elements as fit in max_length. All but the
+  // last message have OFPMPF_REQ_MORE or OFPMPF_REPLY_MORE set. Elements
+  // are moved from the body. Throws std::runtime_error without touching
+  // the body if an element does not fit in max_length.
+  template <class Message>
+  auto split_multipart(
+        typename Message::body_type&& body
+      , std::uint32_t const xid = get_xid()
+      , std::uint16_t const max_length
+          = std::numeric_limits<std::uint16_t>::max())
+    -> std::vector<Message>
+  {
+    using body_type = typename Message::body_type;
+
+    if (max_length < Message::min_length()) {
+      throw std::invalid_argument{"too small max length"};
+    }
+    auto const max_body_length
+      = std::size_t(max_length - Message::min_length());
+
+    // every element is checked before the first one is moved
+    auto chunk_sizes = std::vector<std::size_t>{};
+    auto num_elements = std::size_t{0};
+    auto body_length = std::size_t{0};
+    for (auto it = body.cbegin(); it != body.cend(); ++it) {
+      auto const length = std::size_t(it->byte_length());
+      if (length > max_body_length) {
+        throw std::runtime_error{"too large element length"};
+      }
+      if (body_length + length > max_body_length) {
+        chunk_sizes.push_back(num_elements);
+        num_elements = 0;
+        body_length = 0;
+      }
+      ++num_elements;
+      body_length += length;
+    }
+    chunk_sizes.push_back(num_elements);
+
+    // spliced off from the back, so that no element is moved twice
+    auto tails = std::vector<body_type>{};
+    tails.reserve(chunk_sizes.size() - 1);
+    for (auto i = chunk_sizes.size() - 1; i > 0; --i) {
+      tails.emplace_back(body.get_allocator());
+      tails.back().splice(
+            tails.back().cend(), body
+          , std::prev(body.cend(), chunk_sizes[i]), body.cend());
+    }
+
+    auto messages = std::vector<Message>{};
+    messages.reserve(chunk_sizes.size());
+    messages.emplace_back(
+          std::move(body)
+        , tails.empty() ? 0 : multipart_splitter_detail::more_flag<Message>()
+        , xid);
+    for (auto it = tails.rbegin(); it != tails.rend(); ++it) {
+      messages.emplace_back(
+            std::move(*it)
+          , std::next(it) != tails.rend()
+              ? multipart_splitter_detail::more_flag<Message>() : 0
+          , xid);
+    }
+    return messages;
+  }
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_MULTIPART_SPLITTER_HPP
@@ -0,0 +1,332 @@
+#ifndef CANARD_NET_OFP_V13_REQUEST_TRACKER_HPP
+#define CANARD_NET_OFP_V13_REQUEST_TRACKER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <boost/optional/optional.hpp>
+#include <canard/net/ofp/v13/message/error.hpp>
+#include <canard/net/ofp/v13/openflow.hpp>
+
+namespace canard {
+namespace net {
+namespace ofp {
+namespace v13 {
+
+  namespace request_tracker_detail {
+
+    inline auto has_reply(std::uint8_t const request_type) noexcept
+      -> bool
+    {
+      switch (request_type) {
+      case protocol::OFPT_ECHO_REQUEST:
+      case protocol::OFPT_FEATURES_REQUEST:
+      case protocol::OFPT_GET_CONFIG_REQUEST:
+      case protocol::OFPT_MULTIPART_REQUEST:
+      case protocol::OFPT_BARRIER_REQUEST:
+      case protocol::OFPT_QUEUE_GET_CONFIG_REQUEST:
+      case protocol::OFPT_ROLE_REQUEST:
+      case protocol::OFPT_GET_ASYNC_REQUEST:
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    // each reply type directly follows its request type
+    constexpr auto reply_type(std::uint8_t const request_type) noexcept
+      -> std::uint8_t
+    {
+      return request_type + 1;
+    }
+
+    template <class Reply>
+    auto has_more(Reply const& reply, std::true_type) noexcept
+      -> bool
+    {
+      return reply.flags() & protocol::OFPMPF_REPLY_MORE;
+    }
+
+    template <class Reply>
+    auto has_more(Reply const&, std::false_type) noexcept
+      -> bool
+    {
+      return false;
+    }
+
+  } // namespace request_tracker_detail
+
+  // Allocates the xids of a connection and matches the replies and errors
+  // received on it with the requests sent, keeping round trip time
+  // statistics per request type.
+  //
+  // A request with a reply is completed by its last reply or by an error.
+  // A request without a reply, such as a flow_mod, is completed by an
+  // error or by the reply of a barrier request sent after it. Requests
+  // which are not completed within the timeout are discarded by expire().
+  //
+  // The tracker is not synchronized. Each connection is expected to own
+  // one and use it from the thread or strand handling the connection.
+  template <class Clock = std::chrono::steady_clock>
+  class request_tracker
+  {
+  public:
+    using clock_type = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    struct completion
+    {
+      std::uint32_t xid;
+      protocol::ofp_type request_type;
+      duration round_trip_time;
+      bool failed;
+    };
+
+    struct rtt_statistics
+    {
+      std::uint64_t count;
+      std::uint64_t num_failed;
+      std::uint64_t num_expired;
+      duration min;
+      duration max;
+      duration total;
+
+      auto mean() const noexcept
+        -> duration
+      {
+        return count == 0
+          ? duration::zero()
+          : total / static_cast<typename duration::rep>(count);
+      }
+    };
+
+    static constexpr std::size_t default_max_requests = 1024;
+
+    explicit request_tracker(
+          duration const timeout
+        , std::uint32_t const initial_xid = 0
+        , std::size_t const max_requests = default_max_requests)
+      : statistics_{}
+      , timeout_(timeout)
+      , max_requests_(max_requests)
+      , next_xid_(initial_xid)
+      , next_sequence_(0)
+    {
+    }
+
+    auto next_xid() noexcept
+      -> std::uint32_t
+    {
+      return next_xid_++;
+    }
+
+    // number of outstanding requests
+    auto size() const noexcept
+      -> std::size_t
+    {
+      return requests_.size();
+    }
+
+    auto empty() const noexcept
+      -> bool
+    {
+      return requests_.empty();
+    }
+
+    auto contains(std::uint32_t const xid) const
+      -> bool
+    {
+      return requests_.find(xid) != requests_.end();
+    }
+
+    auto statistics(protocol::ofp_type const request_type) const
+      -> rtt_statistics const&
+    {
+      return statistics_.at(request_type);
+    }
+
+    template <class Request>
+    void track(Request const& request, time_point const now = clock_type::now())
+    {
+      track(request.xid(), request.type(), now);
+    }
+
+    // Records a request sent at now. Tracking the xid of an outstanding
+    // request of the same type, as each part of a multipart request split by
+    // OFPMPF_REQ_MORE has, keeps the time of the first one.
+    void track(
+          std::uint32_t const xid, protocol::ofp_type const request_type
+        , time_point const now = clock_type::now())
+    {
+      if (std::size_t(request_type) >= statistics_.size()) {
+        throw std::invalid_argument{"invalid request type"};
+      }
+      auto const it = requests_.find(xid);
+      if (it != requests_.end()) {
+        if (it->second.type != request_type) {
+          throw std::invalid_argument{"xid of outstanding request"};
+        }
+        return;
+      }
+      if (requests_.size() >= max_requests_) {
+        throw std::length_error{"too many outstanding requests"};
+      }
+      requests_.emplace(xid, request{request_type, next_sequence_++, now});
+    }
+
+    // Returns the completed request when the reply is the last one for it.
+    template <class Reply>
+    auto resolve(Reply const& reply, time_point const now = clock_type::now())
+      -> boost::optional<completion>
+    {
+      using is_multipart_reply = std::integral_constant<
+        bool, Reply::message_type == protocol::OFPT_MULTIPART_REPLY
+      >;
+      auto const it = requests_.find(reply.xid());
+      if (it == requests_.end()
+          || !request_tracker_detail::has_reply(it->second.type)
+          || request_tracker_detail::reply_type(it->second.type)
+              != reply.type()
+          || request_tracker_detail::has_more(reply, is_multipart_reply{})) {
+        return boost::none;
+      }
+      if (reply.type() == protocol::OFPT_BARRIER_REPLY) {
+        complete_before(it->second.sequence, now);
+      }
+      return complete(it, now, false);
+    }
+
+    // Finds the failed request by the header echoed in the error data, or
+    // by the xid of the error if the data is too short to hold it.
+    auto resolve(
+          messages::error const& error
+        , time_point const now = clock_type::now())
+      -> boost::optional<completion>
+    {
+      if (error.data_length() < sizeof(protocol::ofp_header)) {
+        auto const it = requests_.find(error.xid());
+        if (it == requests_.end()) {
+          return boost::none;
+        }
+        return complete(it, now, true);
+      }
+      auto const header = error.failed_request_header();
+      auto const it = requests_.find(header.xid);
+      if (it == requests_.end() || it->second.type != header.type) {
+        return boost::none;
+      }
+      return complete(it, now, true);
+    }
+
+    // Discards the requests whose timeout has passed and returns their
+    // number.
+    auto expire(time_point const now = clock_type::now())
+      -> std::size_t
+    {
+      auto num_expired = std::size_t{0};
+      for (auto it = requests_.begin(); it != requests_.end(); ) {
+        if (it->second.sent_at + timeout_ <= now) {
+          ++statistics_[it->second.type].num_expired;
+          it = requests_.erase(it);
+          ++num_expired;
+        }
+        else {
+          ++it;
+        }
+      }
+      return num_expired;
+    }
+
+    auto abort(std::uint32_t const xid)
+      -> bool
+    {
+      return requests_.erase(xid) != 0;
+    }
+
+    void clear() noexcept
+    {
+      requests_.clear();
+    }
+
+  private:
+    struct request
+    {
+      std::uint8_t type;
+      std::uint64_t sequence;
+      time_point sent_at;
+    };
+
+    using request_map = std::unordered_map<std::uint32_t, request>;
+
+    auto complete(
+          typename request_map::iterator const it
+        , time_point const now, bool const failed)
+      -> completion
+    {
+      auto const result = completion{
+          it->first
+        , protocol::ofp_type(it->second.type)
+        , now - it->second.sent_at
+        , failed
+      };
+      record(it->second.type, result.round_trip_time, failed);
+      requests_.erase(it);
+      return result;
+    }
+
+    // completes the requests without reply sent before the barrier request
+    void complete_before(std::uint64_t const sequence, time_point const now)
+    {
+      for (auto it = requests_.begin(); it != requests_.end(); ) {
+        if (it->second.sequence < sequence
+            && !request_tracker_detail::has_reply(it->second.type)) {
+          record(it->second.type, now - it->second.sent_at, false);
+          it = requests_.erase(it);
+        }
+        else {
+          ++it;
+        }
+      }
+    }
+
+    void record(
+          std::uint8_t const request_type
+        , duration const round_trip_time, bool const failed) noexcept
+    {
+      auto& stats = statistics_[request_type];
+      if (stats.count == 0 || round_trip_time < stats.min) {
+        stats.min = round_trip_time;
+      }
+      if (stats.count == 0 || round_trip_time > stats.max) {
+        stats.max = round_trip_time;
+      }
+      stats.total += round_trip_time;
+      ++stats.count;
+      if (failed) {
+        ++stats.num_failed;
+      }
+    }
+
+  private:
+    request_map requests_;
+    std::array<rtt_statistics, protocol::OFPT_METER_MOD + 1> statistics_;
+    duration timeout_;
+    std::size_t max_requests_;
+    std::uint32_t next_xid_;
+    std::uint64_t next_sequence_;
+  };
+
+  template <class Clock>
+  constexpr std::size_t request_tracker<Clock>::default_max_requests;
+
+} // namespace v13
+} // namespace ofp
+} // namespace net
+} // namespace canard
+
+#endif // CANARD_NET_OFP_V13_REQUEST_TRACKER_HPP
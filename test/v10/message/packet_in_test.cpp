@@ -2,6 +2,8 @@
 #include <canard/net/ofp/v10/message/packet_in.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 #include "../../test_utility.hpp"
 
 namespace ofp = canard::net::ofp;
@@ -227,5 +229,53 @@ BOOST_AUTO_TEST_SUITE(packet_in)
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
 
+  BOOST_FIXTURE_TEST_SUITE(view, packet_in_fixture)
+    BOOST_AUTO_TEST_CASE(refers_frame_in_binary)
+    {
+      unsigned char const* it = bin.data();
+
+      auto const view = msg::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      BOOST_TEST((it == bin.data() + bin.size()));
+      BOOST_TEST(view.xid() == sut.xid());
+      BOOST_TEST(view.buffer_id() == sut.buffer_id());
+      BOOST_TEST(view.total_length() == sut.total_length());
+      BOOST_TEST(view.in_port() == sut.in_port());
+      BOOST_TEST(view.reason() == sut.reason());
+      BOOST_TEST((view.frame().begin() == bin.data() + ofp_packet_in_size));
+      BOOST_TEST(view.frame_length() == sut.frame_length());
+    }
+    BOOST_AUTO_TEST_CASE(packet_in_is_constructible_from_view)
+    {
+      unsigned char const* it = bin.data();
+      auto const view = msg::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      auto const packet_in = msg::packet_in{view};
+
+      BOOST_TEST((packet_in == sut));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_length)
+    {
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            msg::packet_in_view::decode(it, bin.data() + bin.size() - 1)
+          , v10::exception);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_packet_in)
+    {
+      auto const truncated = std::vector<unsigned char>(
+          bin.begin(), bin.begin() + sizeof(protocol::ofp_header));
+      unsigned char const* it = truncated.data();
+
+      BOOST_CHECK_THROW(
+            msg::packet_in_view::decode(
+              it, truncated.data() + truncated.size())
+          , v10::exception);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // view
+
 BOOST_AUTO_TEST_SUITE_END() // packet_in
 BOOST_AUTO_TEST_SUITE_END() // message_test
@@ -0,0 +1,29 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/message_batch.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <canard/net/ofp/v10/message/barrier.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v10 = ofp::v10;
+namespace msg = v10::messages;
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(message_batch)
+  BOOST_AUTO_TEST_CASE(inserts_barrier_request_of_version)
+  {
+    auto sut = ofp::message_batch{v10::protocol::OFP_VERSION};
+    sut.assign_xids_from(1);
+    sut.insert_barrier_every(1);
+
+    sut.push_back(msg::barrier_reply{0});
+
+    BOOST_TEST(sut.size() == 2);
+    BOOST_TEST(sut.chunk(0)
+            == "\x01\x13\x00\x08\x00\x00\x00\x01"
+               "\x01\x12\x00\x08\x00\x00\x00\x02"_bin
+             , boost::test_tools::per_element{});
+  }
+BOOST_AUTO_TEST_SUITE_END() // message_batch
+BOOST_AUTO_TEST_SUITE_END() // utility_test
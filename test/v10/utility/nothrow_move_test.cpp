@@ -0,0 +1,98 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v10/messages.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <canard/net/ofp/v10/action_list.hpp>
+#include <canard/net/ofp/v10/actions.hpp>
+#include <canard/net/ofp/v10/any_action.hpp>
+#include <canard/net/ofp/v10/any_queue_property.hpp>
+#include <canard/net/ofp/v10/flow_entry.hpp>
+#include <canard/net/ofp/v10/queue_properties.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v10 = ofp::v10;
+
+namespace {
+
+  using owning_types = std::tuple<
+      v10::flow_entry
+    , v10::action_list
+    , v10::any_action
+    , v10::any_queue_property
+  >;
+
+  // Types which own an ofp::list. The list allocator does not propagate
+  // its memory resource on move assignment, as in std::pmr, so assigning a
+  // list bound to another resource moves the elements one by one and may
+  // allocate. Move assignment of these types is therefore not noexcept;
+  // move construction still is.
+  using list_owning_types = std::tuple<
+      v10::messages::features_reply
+    , v10::messages::queue_get_config_reply
+    , v10::messages::statistics::flow_stats_reply
+    , v10::messages::statistics::table_stats_reply
+    , v10::messages::statistics::port_stats_reply
+    , v10::messages::statistics::queue_stats_reply
+    , v10::flow_entry
+    , v10::action_list
+  >;
+
+  template <class T, class Tuple>
+  struct is_one_of
+    : std::false_type
+  {};
+
+  template <class T, class U, class... Us>
+  struct is_one_of<T, std::tuple<U, Us...>>
+    : std::conditional<
+          std::is_same<T, U>::value
+        , std::true_type, is_one_of<T, std::tuple<Us...>>
+      >::type
+  {};
+
+  template <class T>
+  void check_nothrow_move()
+  {
+    static_assert(
+          std::is_nothrow_move_constructible<T>::value
+        , "move constructor must be noexcept");
+    static_assert(
+          std::is_nothrow_move_assignable<T>::value
+       != is_one_of<T, list_owning_types>::value
+        , "move assignment must be noexcept unless the type owns a list");
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(nothrow_move)
+
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      switch_message, T, v10::default_switch_message_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      stats_reply, T, v10::default_stats_reply_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(action, T, v10::default_action_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      queue_property, T, v10::default_queue_property_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(owning_type, T, owning_types)
+  {
+    check_nothrow_move<T>();
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // nothrow_move
+BOOST_AUTO_TEST_SUITE_END() // utility_test
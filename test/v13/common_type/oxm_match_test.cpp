@@ -2,11 +2,14 @@
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
+#include <canard/net/ofp/memory_resource.hpp>
 #include <canard/net/ofp/v13/io/openflow.hpp>
 #include "../../test_utility.hpp"
 
@@ -88,6 +91,24 @@ namespace {
         ""_bin;
   };
 
+  struct counting_resource : ofp::memory_resource
+  {
+    std::size_t allocations = 0;
+
+  private:
+    auto do_allocate(std::size_t const bytes, std::size_t)
+      -> void* override
+    {
+      ++allocations;
+      return ::operator new(bytes);
+    }
+
+    void do_deallocate(void* const ptr, std::size_t, std::size_t) override
+    {
+      ::operator delete(ptr);
+    }
+  };
+
 }
 
 BOOST_AUTO_TEST_SUITE(common_type_test)
@@ -236,6 +257,92 @@ BOOST_AUTO_TEST_SUITE(oxm_match)
     }
   BOOST_AUTO_TEST_SUITE_END() // extract_oxm_fields
 
+  BOOST_AUTO_TEST_SUITE(field_lookup)
+    BOOST_FIXTURE_TEST_CASE(contains_fields_in_list, oxm_match_fixture)
+    {
+      BOOST_TEST(sut.contains<fields::in_port>());
+      BOOST_TEST(sut.contains<fields::ipv4_src>());
+      BOOST_TEST(!sut.contains<fields::ipv4_dst>());
+    }
+    BOOST_FIXTURE_TEST_CASE(contains_all_fields, oxm_match_fixture)
+    {
+      BOOST_TEST((sut.contains_all<fields::eth_type, fields::ip_proto>()));
+      BOOST_TEST((!sut.contains_all<fields::eth_type, fields::tcp_dst>()));
+    }
+    BOOST_FIXTURE_TEST_CASE(get_returns_field, oxm_match_fixture)
+    {
+      BOOST_TEST((sut.get<fields::eth_type>() == eth_type));
+      BOOST_TEST((sut.get<fields::ipv4_src>() == ipv4_src));
+    }
+    BOOST_FIXTURE_TEST_CASE(find_returns_none_if_not_found, oxm_match_fixture)
+    {
+      BOOST_TEST(!sut.find<fields::tcp_src>());
+      BOOST_TEST((*sut.find<fields::vlan_vid>() == vlan_vid));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        get_returns_first_duplicated_field, duplicated_field_fixture)
+    {
+      auto it = bin.begin();
+
+      auto const oxm_match = v13::oxm_match::decode(it, bin.end());
+
+      BOOST_TEST((&oxm_match.get<fields::in_port>()
+               == &v13::any_cast<fields::in_port>(oxm_match.oxm_fields()[0])));
+    }
+    BOOST_FIXTURE_TEST_CASE(index_is_moved_with_fields, oxm_match_fixture)
+    {
+      auto const moved = std::move(sut);
+
+      BOOST_TEST((moved.get<fields::ip_proto>() == ip_proto));
+      BOOST_TEST(!sut.contains<fields::ip_proto>());
+    }
+    BOOST_FIXTURE_TEST_CASE(index_is_cleared_by_extract, oxm_match_fixture)
+    {
+      sut.extract_oxm_fields();
+
+      BOOST_TEST(!sut.contains<fields::in_port>());
+    }
+    BOOST_AUTO_TEST_CASE(get_returns_field_beyond_indexed_fields)
+    {
+      auto const sut = v13::oxm_match{oxm_fields_type{
+          fields::mpls_tc{1}, fields::mpls_label{2}, fields::arp_op{3}
+        , fields::icmpv4_code{4}, fields::icmpv4_type{5}, fields::sctp_dst{6}
+        , fields::sctp_src{7}, fields::udp_dst{8}, fields::udp_src{9}
+        , fields::tcp_dst{10}, fields::tcp_src{11}, fields::ip_proto{12}
+        , fields::ip_ecn{1}, fields::ip_dscp{14}, fields::vlan_pcp{5}
+        , fields::eth_type{16}, fields::metadata{17}, fields::in_phy_port{18}
+        , fields::in_port{19}
+      }};
+
+      BOOST_TEST(sut.get<fields::in_port>().oxm_value() == 19);
+      BOOST_TEST(sut.get<fields::mpls_label>().oxm_value() == 2);
+      BOOST_TEST(sut.get<fields::mpls_tc>().oxm_value() == 1);
+      BOOST_TEST((sut.contains_all<fields::mpls_tc, fields::in_port>()));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        get_returns_field_beyond_indexed_positions, parameter)
+    {
+      auto many_fields = oxm_fields_type{};
+      for (auto i = 0; i < 300; ++i) {
+        many_fields.push_back(in_port);
+      }
+      many_fields.push_back(eth_type);
+      auto const sut = v13::oxm_match{std::move(many_fields)};
+
+      BOOST_TEST((&sut.get<fields::eth_type>()
+               == &v13::any_cast<fields::eth_type>(sut.oxm_fields()[300])));
+      BOOST_TEST((&sut.get<fields::in_port>()
+               == &v13::any_cast<fields::in_port>(sut.oxm_fields()[0])));
+    }
+    BOOST_AUTO_TEST_CASE(index_is_bounded_by_indexed_fields)
+    {
+      using index_type = ofp::detail::v13::oxm_field_index;
+
+      BOOST_TEST(sizeof(index_type)
+              <= sizeof(std::uint64_t) + index_type::max_indexed_fields);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // field_lookup
+
   BOOST_FIXTURE_TEST_SUITE(calc_ofp_length, oxm_match_fixture)
     BOOST_AUTO_TEST_CASE(return_length)
     {
@@ -540,5 +647,49 @@ BOOST_AUTO_TEST_SUITE(oxm_match)
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
 
+  BOOST_AUTO_TEST_SUITE(inline_storage)
+    BOOST_FIXTURE_TEST_CASE(decode_short_match_without_allocation, parameter)
+    {
+      auto const sut = v13::oxm_match{oxm_fields_type{
+        in_port, eth_dst, eth_src, eth_type, ip_proto, ipv4_src
+      }};
+      auto bin = std::vector<unsigned char>{};
+      sut.encode(bin);
+      auto resource = counting_resource{};
+      ofp::scoped_memory_resource const scope{resource};
+      auto it = bin.begin();
+
+      auto const oxm_match = v13::oxm_match::decode(it, bin.end());
+
+      BOOST_TEST(resource.allocations == 0);
+      BOOST_TEST((oxm_match == sut));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        decode_long_match_with_single_allocation, oxm_match_fixture)
+    {
+      auto resource = counting_resource{};
+      ofp::scoped_memory_resource const scope{resource};
+      auto it = bin.begin();
+
+      auto const oxm_match = v13::oxm_match::decode(it, bin.end());
+
+      BOOST_TEST(resource.allocations == 1);
+      BOOST_TEST((oxm_match == sut));
+    }
+    BOOST_FIXTURE_TEST_CASE(copy_short_match_without_allocation, parameter)
+    {
+      auto const sut = v13::oxm_match{oxm_fields_type{
+        in_port, eth_dst, eth_type, ip_proto
+      }};
+      auto resource = counting_resource{};
+      ofp::scoped_memory_resource const scope{resource};
+
+      auto const copy = sut;
+
+      BOOST_TEST(resource.allocations == 0);
+      BOOST_TEST((copy == sut));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // inline_storage
+
 BOOST_AUTO_TEST_SUITE_END() // oxm_match
 BOOST_AUTO_TEST_SUITE_END() // common_type_test
@@ -0,0 +1,137 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/common/oxm_match_view.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace fields = v13::oxm_match_fields;
+namespace protocol = v13::protocol;
+
+namespace {
+
+  struct oxm_match_view_fixture
+  {
+    fields::in_port in_port{protocol::OFPP_MAX};
+    fields::eth_type eth_type{0x0800};
+    fields::ipv4_src ipv4_src{"192.168.10.0"_ipv4, 24};
+    v13::oxm_match match{in_port, eth_type, ipv4_src};
+    std::vector<unsigned char> bin
+      = "\x00\x01\x00\x1e"
+        "\x80\x00\x00\x04\xff\xff\xff\x00"
+        "\x80\x00\x0a\x02\x08\x00"
+        "\x80\x00\x17\x08\xc0\xa8\x0a\x00\xff\xff\xff\x00"
+        "\x00\x00"
+        ""_bin;
+
+    auto decode_view()
+      -> v13::oxm_match_view
+    {
+      unsigned char const* it = bin.data();
+      return v13::oxm_match_view::decode(it, bin.data() + bin.size());
+    }
+  };
+
+}
+
+BOOST_AUTO_TEST_SUITE(common_type_test)
+BOOST_FIXTURE_TEST_SUITE(oxm_match_view, oxm_match_view_fixture)
+
+  BOOST_AUTO_TEST_CASE(is_constructible_from_binary)
+  {
+    unsigned char const* it = bin.data();
+
+    auto const sut = v13::oxm_match_view::decode(it, bin.data() + bin.size());
+
+    BOOST_TEST((it == bin.data() + bin.size()));
+    BOOST_TEST(sut.length() == 0x1e);
+    BOOST_TEST(sut.byte_length() == bin.size());
+  }
+
+  BOOST_AUTO_TEST_CASE(iterates_raw_fields)
+  {
+    auto const sut = decode_view();
+
+    BOOST_TEST(std::distance(sut.begin(), sut.end()) == 3);
+    auto it = sut.begin();
+    BOOST_TEST((*it).header().oxm_type() == fields::in_port::oxm_type());
+    BOOST_TEST((*it).value().size() == 4);
+    ++it;
+    BOOST_TEST((*it).header().oxm_type() == fields::eth_type::oxm_type());
+    BOOST_TEST((*it).value().size() == 2);
+    ++it;
+    BOOST_TEST((*it).header().oxm_type() == fields::ipv4_src::oxm_type());
+    BOOST_TEST((*it).header().oxm_hasmask());
+    BOOST_TEST((*it).value().size() == 8);
+  }
+
+  BOOST_AUTO_TEST_CASE(finds_field)
+  {
+    auto const sut = decode_view();
+
+    auto const field = sut.find<fields::ipv4_src>();
+
+    BOOST_TEST_REQUIRE(bool(field));
+    BOOST_TEST((*field == ipv4_src));
+    BOOST_TEST(sut.contains<fields::eth_type>());
+  }
+
+  BOOST_AUTO_TEST_CASE(returns_none_if_field_is_not_contained)
+  {
+    auto const sut = decode_view();
+
+    BOOST_TEST(!sut.find<fields::eth_dst>());
+    BOOST_TEST(!sut.contains<fields::eth_dst>());
+  }
+
+  BOOST_AUTO_TEST_CASE(is_convertible_to_oxm_match)
+  {
+    auto const sut = decode_view();
+
+    BOOST_TEST((sut.to_oxm_match() == match));
+  }
+
+  BOOST_AUTO_TEST_CASE(validates_only_accessed_field)
+  {
+    bin[15] = 0x03; // length of eth_type
+    auto const sut = decode_view();
+
+    BOOST_TEST(sut.find<fields::in_port>()->oxm_value() == protocol::OFPP_MAX);
+    BOOST_CHECK_THROW(sut.find<fields::eth_type>(), v13::exception);
+  }
+
+  BOOST_AUTO_TEST_CASE(stops_iteration_at_truncated_field)
+  {
+    bin[3] = 0x1c;
+    auto const sut = decode_view();
+
+    BOOST_TEST(std::distance(sut.begin(), sut.end()) == 2);
+    BOOST_TEST(!sut.find<fields::ipv4_src>());
+  }
+
+  BOOST_AUTO_TEST_CASE(throw_exception_if_match_type_is_invalid)
+  {
+    bin[1] = 0x00;
+    unsigned char const* it = bin.data();
+
+    BOOST_CHECK_THROW(
+          v13::oxm_match_view::decode(it, bin.data() + bin.size())
+        , v13::exception);
+  }
+
+  BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_ofp_match)
+  {
+    auto const truncated = "\x00\x01\x00\x04\x00\x00"_bin;
+    unsigned char const* it = truncated.data();
+
+    BOOST_CHECK_THROW(
+          v13::oxm_match_view::decode(it, truncated.data() + truncated.size())
+        , v13::exception);
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // oxm_match_view
+BOOST_AUTO_TEST_SUITE_END() // common_type_test
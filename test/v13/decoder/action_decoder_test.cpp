@@ -0,0 +1,176 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/decoder/action_decoder.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace actions = v13::actions;
+namespace protocol = v13::protocol;
+
+namespace {
+  struct action_decoder_fixture
+  {
+    actions::output output{0x01020304, 0x1234};
+    std::vector<unsigned char> output_bin
+      = "\x00\x00\x00\x10\x01\x02\x03\x04""\x12\x34\x00\x00\x00\x00\x00\x00"
+        ""_bin;
+    actions::set_eth_type set_eth_type{0x0800};
+    std::vector<unsigned char> set_eth_type_bin
+      = "\x00\x19\x00\x10\x80\x00\x0a\x02""\x08\x00\x00\x00\x00\x00\x00\x00"
+        ""_bin;
+    actions::pop_pbb pop_pbb{};
+    std::vector<unsigned char> pop_pbb_bin
+      = "\x00\x1b\x00\x08\x00\x00\x00\x00"_bin;
+  };
+
+  struct discard
+  {
+    template <class T>
+    void operator()(T&&) const {}
+  };
+
+  template <class T>
+  struct to_optional
+  {
+    using result_type = boost::optional<T>;
+    auto operator()(T const& t) const -> result_type
+    { return result_type{t}; }
+    template <class U>
+    auto operator()(U const&) const -> result_type
+    { return boost::none; }
+  };
+
+  template <std::uint32_t ErrorType, std::uint16_t ErrorCode>
+  auto is_error(v13::exception const& e)
+    -> bool
+  {
+    return e.error_type() == ErrorType && e.error_code() == ErrorCode;
+  }
+
+  using output_only_decoder = v13::basic_action_decoder<
+    std::tuple<actions::output>, std::tuple<actions::set_eth_type>
+  >;
+}
+
+BOOST_AUTO_TEST_SUITE(decoder_test)
+BOOST_AUTO_TEST_SUITE(action_decoder)
+  BOOST_AUTO_TEST_SUITE(type_definition_test)
+    BOOST_AUTO_TEST_CASE(decode_type_list)
+    {
+      using sut = v13::action_decoder;
+
+      using is_same = std::is_same<
+        sut::decode_type_list, v13::default_all_action_list
+      >;
+
+      BOOST_TEST(is_same::value);
+    }
+    BOOST_AUTO_TEST_CASE(decode_type_list_of_extended_decoder)
+    {
+      using sut = output_only_decoder;
+
+      using is_same = std::is_same<
+          sut::decode_type_list
+        , std::tuple<actions::output, actions::set_eth_type>
+      >;
+
+      BOOST_TEST(is_same::value);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // type_definition_test
+
+  BOOST_FIXTURE_TEST_SUITE(decode, action_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_output_if_binary_is_output)
+    {
+      auto it = output_bin.begin();
+      using f = to_optional<actions::output>;
+
+      auto const action = v13::action_decoder::decode<f::result_type>(
+          it, output_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(action));
+      BOOST_TEST((*action == output));
+      BOOST_TEST((it == output_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_pop_pbb_if_binary_is_pop_pbb)
+    {
+      auto it = pop_pbb_bin.begin();
+      using f = to_optional<actions::pop_pbb>;
+
+      auto const action = v13::action_decoder::decode<f::result_type>(
+          it, pop_pbb_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(action));
+      BOOST_TEST((*action == pop_pbb));
+      BOOST_TEST((it == pop_pbb_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_set_field_if_binary_is_set_field)
+    {
+      auto it = set_eth_type_bin.begin();
+      using f = to_optional<actions::set_eth_type>;
+
+      auto const action = output_only_decoder::decode<f::result_type>(
+          it, set_eth_type_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(action));
+      BOOST_TEST((*action == set_eth_type));
+      BOOST_TEST((it == set_eth_type_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_action_is_not_in_list)
+    {
+      auto it = pop_pbb_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            output_only_decoder::decode<void>(it, pop_pbb_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_action
+              , protocol::bad_action_code::bad_type>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_action_length_is_invalid)
+    {
+      output_bin[3] = 0x08;
+      auto it = output_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::action_decoder::decode<void>(it, output_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_action
+              , protocol::bad_action_code::bad_len>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_set_field_is_not_in_list)
+    {
+      set_eth_type_bin[6] = 0x0c;
+      auto it = set_eth_type_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            output_only_decoder::decode<void>(
+              it, set_eth_type_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_action
+              , protocol::bad_action_code::bad_set_type>));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_FIXTURE_TEST_SUITE(try_decode, action_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(return_error_if_action_is_not_in_list)
+    {
+      auto it = pop_pbb_bin.begin();
+
+      auto const result = output_only_decoder::try_decode<void>(
+          it, pop_pbb_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_ACTION);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBAC_BAD_TYPE);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
+BOOST_AUTO_TEST_SUITE_END() // action_decoder
+BOOST_AUTO_TEST_SUITE_END() // decoder_test
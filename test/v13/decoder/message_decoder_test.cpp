@@ -0,0 +1,384 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/decoder/message_decoder.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace msg = v13::messages;
+namespace multipart = msg::multipart;
+namespace protocol = v13::protocol;
+
+namespace {
+  struct message_decoder_fixture
+  {
+    msg::barrier_reply barrier_reply{0x01020304};
+    std::vector<unsigned char> barrier_reply_bin
+      = "\x04\x15\x00\x08\x01\x02\x03\x04"_bin;
+    msg::echo_request echo_request{"\x01\x02\x03"_bbin, 0x05060708};
+    std::vector<unsigned char> echo_request_bin
+      = "\x04\x02\x00\x0b\x05\x06\x07\x08""\x01\x02\x03"_bin;
+    multipart::port_description_request port_desc_request{0x11121314};
+    std::vector<unsigned char> port_desc_request_bin
+      = "\x04\x12\x00\x10\x11\x12\x13\x14""\x00\x0d\x00\x00\x00\x00\x00\x00"
+        ""_bin;
+    multipart::port_description_reply port_desc_reply{
+      multipart::port_description_reply::body_type{}, 0, 0x21222324
+    };
+    std::vector<unsigned char> port_desc_reply_bin
+      = "\x04\x13\x00\x10\x21\x22\x23\x24""\x00\x0d\x00\x00\x00\x00\x00\x00"
+        ""_bin;
+  };
+
+  struct discard
+  {
+    template <class T>
+    void operator()(T&&) const {}
+  };
+
+  template <class T>
+  struct to_optional
+  {
+    using result_type = boost::optional<T>;
+    auto operator()(T const& t) const -> result_type
+    { return result_type{t}; }
+    template <class U>
+    auto operator()(U const&) const -> result_type
+    { return boost::none; }
+  };
+
+  template <std::uint32_t ErrorType, std::uint16_t ErrorCode>
+  auto is_error(v13::exception const& e)
+    -> bool
+  {
+    return e.error_type() == ErrorType && e.error_code() == ErrorCode;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(decoder_test)
+BOOST_AUTO_TEST_SUITE(message_decoder)
+  BOOST_AUTO_TEST_SUITE(type_definition_test)
+    BOOST_AUTO_TEST_CASE(header_type)
+    {
+      using sut = v13::message_decoder;
+
+      using is_same = std::is_same<sut::header_type, protocol::ofp_header>;
+
+      BOOST_TEST(is_same::value);
+    }
+    BOOST_AUTO_TEST_CASE(decode_type_list)
+    {
+      using sut = v13::message_decoder;
+
+      using is_same = std::is_same<
+        sut::decode_type_list, v13::default_switch_message_list
+      >;
+
+      BOOST_TEST(is_same::value);
+    }
+    BOOST_AUTO_TEST_CASE(multipart_type_list)
+    {
+      using sut = v13::controller_message_decoder;
+
+      using is_same = std::is_same<
+        sut::multipart_type_list, v13::default_multipart_request_list
+      >;
+
+      BOOST_TEST(is_same::value);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // type_definition_test
+
+  BOOST_FIXTURE_TEST_SUITE(decode, message_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_barrier_reply_if_binary_is_barrier_reply)
+    {
+      auto it = barrier_reply_bin.begin();
+      using f = to_optional<msg::barrier_reply>;
+
+      auto const message = v13::message_decoder::decode<f::result_type>(
+          it, barrier_reply_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(message));
+      BOOST_TEST((*message == barrier_reply));
+      BOOST_TEST((it == barrier_reply_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_echo_request_if_binary_is_echo_request)
+    {
+      auto it = echo_request_bin.begin();
+      using f = to_optional<msg::echo_request>;
+
+      auto const message = v13::message_decoder::decode<f::result_type>(
+          it, echo_request_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(message));
+      BOOST_TEST((*message == echo_request));
+      BOOST_TEST((it == echo_request_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_multipart_reply_if_binary_is_multipart_reply)
+    {
+      auto it = port_desc_reply_bin.begin();
+      using f = to_optional<multipart::port_description_reply>;
+
+      auto const message = v13::message_decoder::decode<f::result_type>(
+          it, port_desc_reply_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(message));
+      BOOST_TEST((*message == port_desc_reply));
+      BOOST_TEST((it == port_desc_reply_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_multipart_request_by_controller_decoder)
+    {
+      auto it = port_desc_request_bin.begin();
+      using f = to_optional<multipart::port_description_request>;
+
+      auto const message
+        = v13::controller_message_decoder::decode<f::result_type>(
+            it, port_desc_request_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(message));
+      BOOST_TEST((*message == port_desc_request));
+      BOOST_TEST((it == port_desc_request_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(consume_only_one_message)
+    {
+      auto bin = barrier_reply_bin;
+      bin.insert(bin.end(), echo_request_bin.begin(), echo_request_bin.end());
+      auto it = bin.begin();
+
+      v13::message_decoder::decode<void>(it, bin.end(), discard{});
+
+      BOOST_TEST(
+          std::size_t(std::distance(bin.begin(), it))
+          == barrier_reply_bin.size());
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_header)
+    {
+      barrier_reply_bin.resize(sizeof(protocol::ofp_header) - 1);
+      auto it = barrier_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, barrier_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_LEN>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_length)
+    {
+      echo_request_bin.pop_back();
+      auto it = echo_request_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, echo_request_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_LEN>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_version_is_not_supported)
+    {
+      barrier_reply_bin[0] = 0x01;
+      auto it = barrier_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, barrier_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+              protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_VERSION>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_message_type_is_not_in_list)
+    {
+      auto it = port_desc_request_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, port_desc_request_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_TYPE>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_message_type_is_out_of_table)
+    {
+      barrier_reply_bin[1] = 0xff;
+      auto it = barrier_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, barrier_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_TYPE>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_multipart_type_is_unknown)
+    {
+      port_desc_reply_bin[8] = 0xff;
+      port_desc_reply_bin[9] = 0xff;
+      auto it = port_desc_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, port_desc_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+              protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_MULTIPART>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_message_length_is_invalid)
+    {
+      barrier_reply_bin[3] = 0x07;
+      auto it = barrier_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, barrier_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_LEN>));
+    }
+    BOOST_AUTO_TEST_CASE(
+        throw_exception_if_message_length_is_smaller_than_header_before_dispatch)
+    {
+      barrier_reply_bin[1] = 0xff;
+      barrier_reply_bin[3] = 0x00;
+      auto it = barrier_reply_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::message_decoder::decode<void>(
+              it, barrier_reply_bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_LEN>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_actions_length_is_invalid)
+    {
+      auto bin
+        = "\x04\x0d\x00\x1a\x00\x00\x00\x01""\xff\xff\xff\xff\x00\x00\x00\x01"
+          "\x00\x02\x00\x00\x00\x00\x00\x00""\x00\x00"_bin;
+      auto it = bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::controller_message_decoder::decode<void>(
+              it, bin.end(), discard{})
+          , v13::exception
+          , (is_error<protocol::OFPET_BAD_REQUEST, protocol::OFPBRC_BAD_LEN>));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_FIXTURE_TEST_SUITE(try_decode, message_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_barrier_reply_if_binary_is_barrier_reply)
+    {
+      auto it = barrier_reply_bin.begin();
+      using f = to_optional<msg::barrier_reply>;
+
+      auto const result = v13::message_decoder::try_decode<f::result_type>(
+          it, barrier_reply_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(result));
+      BOOST_TEST_REQUIRE(bool(result.value()));
+      BOOST_TEST((*result.value() == barrier_reply));
+      BOOST_TEST((it == barrier_reply_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_version_is_not_supported)
+    {
+      barrier_reply_bin[0] = 0x01;
+      auto it = barrier_reply_bin.begin();
+
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, barrier_reply_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_REQUEST);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBRC_BAD_VERSION);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_multipart_type_is_unknown)
+    {
+      port_desc_reply_bin[8] = 0xff;
+      port_desc_reply_bin[9] = 0xff;
+      auto it = port_desc_reply_bin.begin();
+
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, port_desc_reply_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_REQUEST);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBRC_BAD_MULTIPART);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_message_body_is_invalid)
+    {
+      auto bin
+        = "\x04\x0a\x00\x22\x00\x00\x00\x01""\xff\xff\xff\xff\x00\x00\x00\x00"
+          "\x00\x00\x00\x00\x00\x00\x00\x00""\x00\x00\x00\x04\x00\x00\x00\x00"
+          "\x00\x00"_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_MATCH);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBMC_BAD_TYPE);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_actions_length_is_invalid)
+    {
+      auto bin
+        = "\x04\x0d\x00\x1a\x00\x00\x00\x01""\xff\xff\xff\xff\x00\x00\x00\x01"
+          "\x00\x02\x00\x00\x00\x00\x00\x00""\x00\x00"_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::controller_message_decoder::try_decode<void>(
+          it, bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_REQUEST);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBRC_BAD_LEN);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_action_type_is_unknown)
+    {
+      auto bin
+        = "\x04\x0d\x00\x20\x00\x00\x00\x01""\xff\xff\xff\xff\x00\x00\x00\x01"
+          "\x00\x08\x00\x00\x00\x00\x00\x00""\x0f\xff\x00\x08\x00\x00\x00\x00"
+          ""_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::controller_message_decoder::try_decode<void>(
+          it, bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_ACTION);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBAC_BAD_TYPE);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_oxm_fields_length_is_invalid)
+    {
+      auto bin
+        = "\x04\x0a\x00\x22\x00\x00\x00\x01""\xff\xff\xff\xff\x00\x00\x00\x00"
+          "\x00\x00\x00\x00\x00\x00\x00\x00""\x00\x01\x00\x06\x80\x00\x00\x00"
+          "\x00\x00"_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_REQUEST);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBRC_BAD_LEN);
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_multipart_element_length_is_invalid)
+    {
+      auto bin
+        = "\x04\x13\x00\x48\x00\x00\x00\x01""\x00\x01\x00\x00\x00\x00\x00\x00"
+          "\x00\x08\x00\x00\x00\x00\x00\x00""\x00\x00\x00\x00\x00\x00\x00\x00"
+          "\x00\x00\x00\x00\x00\x00\x00\x00""\x00\x00\x00\x00\x00\x00\x00\x00"
+          "\x00\x00\x00\x00\x00\x00\x00\x00""\x00\x00\x00\x00\x00\x00\x00\x00"
+          "\x00\x00\x00\x00\x00\x00\x00\x00"_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::message_decoder::try_decode<void>(
+          it, bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type()
+              == v13::exception::ex_error_type::bad_multipart_element);
+      BOOST_TEST(result.error().error_code()
+              == v13::exception::ex_error_code::bad_length);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
+BOOST_AUTO_TEST_SUITE_END() // message_decoder
+BOOST_AUTO_TEST_SUITE_END() // decoder_test
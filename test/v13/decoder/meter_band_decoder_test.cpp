@@ -114,5 +114,53 @@ BOOST_AUTO_TEST_SUITE(meter_band_decoder)
             });
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_FIXTURE_TEST_SUITE(try_decode, meter_band_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_drop_if_binary_represents_drop)
+    {
+      auto it = drop_bin.begin();
+      using f = to_optional<bands::drop>;
+
+      auto const band = v13::meter_band_decoder::try_decode<f::result_type>(
+          it, drop_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(band));
+      BOOST_TEST(bool(band.value()));
+      BOOST_TEST((*band.value() == drop));
+      BOOST_TEST((it == drop_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_binary_size_is_smaller_than_length)
+    {
+      drop_bin.resize(drop_bin.size() - 1);
+      auto it = drop_bin.begin();
+
+      auto const result = v13::meter_band_decoder::try_decode<void>(
+          it, drop_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(
+          result.error().error_type() == v13::protocol::error_type::bad_request);
+      BOOST_TEST(
+             result.error().error_code()
+          == v13::protocol::bad_request_code::bad_len);
+      BOOST_TEST((it == drop_bin.begin()));
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_meter_band_type_is_unknown)
+    {
+      drop_bin[0] = 0x12;
+      auto it = drop_bin.begin();
+
+      auto const result = v13::meter_band_decoder::try_decode<void>(
+          it, drop_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(
+             result.error().error_type()
+          == v13::protocol::error_type::meter_mod_failed);
+      BOOST_TEST(
+             result.error().error_code()
+          == v13::protocol::meter_mod_failed_code::unknown_meter);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
 BOOST_AUTO_TEST_SUITE_END() // meter_band_decoder
 BOOST_AUTO_TEST_SUITE_END() // decoder_test
@@ -0,0 +1,217 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/decoder/oxm_match_field_decoder.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace match = v13::oxm_match_fields;
+namespace protocol = v13::protocol;
+
+namespace {
+  struct oxm_match_field_decoder_fixture
+  {
+    match::in_port in_port{0x01020304};
+    std::vector<unsigned char> in_port_bin
+      = "\x80\x00\x00\x04\x01\x02\x03\x04"_bin;
+    match::metadata metadata{0x0102030405060700, 0xffffffffffffff00};
+    std::vector<unsigned char> metadata_bin
+      = "\x80\x00\x05\x10\x01\x02\x03\x04""\x05\x06\x07\x00\xff\xff\xff\xff"
+        "\xff\xff\xff\x00"_bin;
+    match::ipv6_exthdr ipv6_exthdr{0x0102};
+    std::vector<unsigned char> ipv6_exthdr_bin
+      = "\x80\x00\x4e\x02\x01\x02"_bin;
+  };
+
+  struct discard
+  {
+    template <class T>
+    void operator()(T&&) const {}
+  };
+
+  template <class T>
+  struct to_optional
+  {
+    using result_type = boost::optional<T>;
+    auto operator()(T const& t) const -> result_type
+    { return result_type{t}; }
+    template <class U>
+    auto operator()(U const&) const -> result_type
+    { return boost::none; }
+  };
+
+  template <std::uint32_t ErrorType, std::uint16_t ErrorCode>
+  auto is_error(v13::exception const& e)
+    -> bool
+  {
+    return e.error_type() == ErrorType && e.error_code() == ErrorCode;
+  }
+
+  using sparse_field_list = std::tuple<
+    match::ipv6_exthdr, match::in_port, match::eth_dst
+  >;
+}
+
+BOOST_AUTO_TEST_SUITE(decoder_test)
+BOOST_AUTO_TEST_SUITE(oxm_match_field_decoder)
+  BOOST_AUTO_TEST_SUITE(type_definition_test)
+    BOOST_AUTO_TEST_CASE(decode_type_list)
+    {
+      using sut = v13::oxm_match_field_decoder;
+
+      using is_same = std::is_same<
+        sut::decode_type_list, v13::default_oxm_match_field_list
+      >;
+
+      BOOST_TEST(is_same::value);
+    }
+    BOOST_AUTO_TEST_CASE(default_fields_are_indexed_directly)
+    {
+      using sut = ofp::detail::v13::decode_table<
+        ofp::detail::v13::oxm_type_key, v13::default_oxm_match_field_list
+      >;
+
+      BOOST_TEST(sut::modulus == sut::size);
+    }
+    BOOST_AUTO_TEST_CASE(sparse_fields_are_hashed_without_collision)
+    {
+      using sut = ofp::detail::v13::decode_table<
+        ofp::detail::v13::oxm_type_key, sparse_field_list
+      >;
+
+      BOOST_TEST(sut::modulus < sut::max_key - sut::min_key + 1);
+      BOOST_TEST(sut::slot(match::ipv6_exthdr::oxm_type())
+              != sut::slot(match::in_port::oxm_type()));
+      BOOST_TEST(sut::slot(match::ipv6_exthdr::oxm_type())
+              != sut::slot(match::eth_dst::oxm_type()));
+      BOOST_TEST(sut::slot(match::in_port::oxm_type())
+              != sut::slot(match::eth_dst::oxm_type()));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // type_definition_test
+
+  BOOST_FIXTURE_TEST_SUITE(decode, oxm_match_field_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_in_port_if_binary_is_in_port)
+    {
+      auto it = in_port_bin.begin();
+      using f = to_optional<match::in_port>;
+
+      auto const field = v13::oxm_match_field_decoder::decode<f::result_type>(
+          it, in_port_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(field));
+      BOOST_TEST((*field == in_port));
+      BOOST_TEST((it == in_port_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_metadata_if_binary_is_masked_metadata)
+    {
+      auto it = metadata_bin.begin();
+      using f = to_optional<match::metadata>;
+
+      auto const field = v13::oxm_match_field_decoder::decode<f::result_type>(
+          it, metadata_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(field));
+      BOOST_TEST((*field == metadata));
+      BOOST_TEST((it == metadata_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(construct_field_by_decoder_of_sparse_field_list)
+    {
+      using sut = v13::basic_oxm_match_field_decoder<sparse_field_list>;
+      auto it = ipv6_exthdr_bin.begin();
+      using f = to_optional<match::ipv6_exthdr>;
+
+      auto const field = sut::decode<f::result_type>(
+          it, ipv6_exthdr_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(field));
+      BOOST_TEST((*field == ipv6_exthdr));
+      BOOST_TEST((it == ipv6_exthdr_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_field_is_not_in_list)
+    {
+      using sut = v13::basic_oxm_match_field_decoder<sparse_field_list>;
+      auto it = metadata_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            sut::decode<void>(it, metadata_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_match
+              , protocol::bad_match_code::bad_field>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_oxm_class_is_unknown)
+    {
+      in_port_bin[0] = 0x7f;
+      auto it = in_port_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::oxm_match_field_decoder::decode<void>(
+              it, in_port_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_match
+              , protocol::bad_match_code::bad_field>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_field_length_is_invalid)
+    {
+      in_port_bin[3] = 0x02;
+      auto it = in_port_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::oxm_match_field_decoder::decode<void>(
+              it, in_port_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_match
+              , protocol::bad_match_code::bad_len>));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_length)
+    {
+      in_port_bin.pop_back();
+      auto it = in_port_bin.begin();
+
+      BOOST_CHECK_EXCEPTION(
+            v13::oxm_match_field_decoder::decode<void>(
+              it, in_port_bin.end(), discard{})
+          , v13::exception
+          , (is_error<
+                protocol::error_type::bad_request
+              , protocol::bad_request_code::bad_len>));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_FIXTURE_TEST_SUITE(try_decode, oxm_match_field_decoder_fixture)
+    BOOST_AUTO_TEST_CASE(construct_in_port_if_binary_is_in_port)
+    {
+      auto it = in_port_bin.begin();
+      using f = to_optional<match::in_port>;
+
+      auto const result
+        = v13::oxm_match_field_decoder::try_decode<f::result_type>(
+            it, in_port_bin.end(), f{});
+
+      BOOST_TEST_REQUIRE(bool(result));
+      BOOST_TEST_REQUIRE(bool(result.value()));
+      BOOST_TEST((*result.value() == in_port));
+      BOOST_TEST((it == in_port_bin.end()));
+    }
+    BOOST_AUTO_TEST_CASE(return_error_if_field_is_not_in_list)
+    {
+      using sut = v13::basic_oxm_match_field_decoder<sparse_field_list>;
+      auto it = metadata_bin.begin();
+
+      auto const result = sut::try_decode<void>(
+          it, metadata_bin.end(), discard{});
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_MATCH);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBMC_BAD_FIELD);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
+BOOST_AUTO_TEST_SUITE_END() // oxm_match_field_decoder
+BOOST_AUTO_TEST_SUITE_END() // decoder_test
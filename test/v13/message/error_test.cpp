@@ -4,7 +4,9 @@
 #include <canard/net/ofp/v13/message/switch_config.hpp>
 #include <cstdint>
 #include <vector>
+#include <boost/asio/buffer.hpp>
 #include <boost/endian/conversion.hpp>
+#include <canard/net/ofp/gather_buffer.hpp>
 
 #include <canard/net/ofp/v13/io/openflow.hpp>
 #include "../../test_utility.hpp"
@@ -189,6 +191,21 @@ BOOST_AUTO_TEST_SUITE(error)
       BOOST_TEST(buffer.size() == sut.byte_length());
       BOOST_TEST(buffer == bin);
     }
+    BOOST_FIXTURE_TEST_CASE(refer_to_data_from_gather_buffer, error_fixture)
+    {
+      auto buffer = of::gather_buffer{0};
+
+      sut.encode(buffer);
+
+      auto const buffers = buffer.buffers();
+      BOOST_TEST_REQUIRE(buffers.size() == 2);
+      BOOST_TEST(boost::asio::buffer_cast<unsigned char const*>(buffers[1])
+              == sut.data().data());
+      BOOST_TEST(boost::asio::buffer_size(buffers[1]) == sut.data().size());
+      auto bytes = std::vector<std::uint8_t>(buffer.size());
+      boost::asio::buffer_copy(boost::asio::buffer(bytes), buffers);
+      BOOST_TEST(bytes == bin);
+    }
   BOOST_AUTO_TEST_SUITE_END() // encode
 
   BOOST_AUTO_TEST_SUITE(decode)
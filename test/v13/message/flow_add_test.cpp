@@ -6,6 +6,7 @@
 #include <vector>
 #include <canard/net/ofp/v13/instructions.hpp>
 #include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/raw_buffer.hpp>
 
 #include "../../test_utility.hpp"
 
@@ -348,6 +349,37 @@ BOOST_AUTO_TEST_SUITE(flow_add)
       BOOST_TEST(buffer.size() == sut.byte_length());
       BOOST_TEST(buffer == bin, boost::test_tools::per_element{});
     }
+    BOOST_FIXTURE_TEST_CASE(generate_binary_to_raw_buffer, flow_add_fixture)
+    {
+      auto buffer = std::vector<std::uint8_t>(sut.byte_length() + 1, 0xff);
+
+      auto const last = of::encode_to(sut, buffer.data(), buffer.size());
+
+      BOOST_TEST(last - buffer.data() == sut.byte_length());
+      BOOST_TEST(
+            std::vector<std::uint8_t>(buffer.data(), last) == bin
+          , boost::test_tools::per_element{});
+      BOOST_TEST(buffer.back() == 0xff);
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        generate_binary_with_exact_allocation, flow_add_fixture)
+    {
+      auto buffer = std::vector<std::uint8_t>{};
+
+      of::encode_exact(sut, buffer);
+
+      BOOST_TEST(buffer.capacity() == sut.byte_length());
+      BOOST_TEST(buffer == bin, boost::test_tools::per_element{});
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        throw_exception_if_raw_buffer_is_too_small, flow_add_fixture)
+    {
+      auto buffer = std::vector<std::uint8_t>(sut.byte_length() - 1);
+
+      BOOST_CHECK_THROW(
+            of::encode_to(sut, buffer.data(), buffer.size())
+          , std::runtime_error);
+    }
   BOOST_AUTO_TEST_SUITE_END() // encode
 
   BOOST_AUTO_TEST_SUITE(decode)
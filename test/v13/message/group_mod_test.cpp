@@ -1,6 +1,7 @@
 #define BOOST_TEST_DYN_LINK
 #include <canard/net/ofp/v13/message/group_mod.hpp>
 #include <boost/test/unit_test.hpp>
+#include <canard/net/ofp/v13/try_decode.hpp>
 #include <cstdint>
 #include <utility>
 
@@ -157,6 +158,33 @@ BOOST_AUTO_TEST_SUITE(group_add)
       BOOST_TEST((group_add == sut));
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_AUTO_TEST_SUITE(try_decode)
+    BOOST_FIXTURE_TEST_CASE(construct_from_binary, group_add_fixture)
+    {
+      auto it = bin.begin();
+
+      auto const result = v13::try_decode<msg::group_add>(it, bin.end());
+
+      BOOST_TEST_REQUIRE(bool(result));
+      BOOST_TEST((it == bin.end()));
+      BOOST_TEST((result.value() == sut));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        return_error_if_bucket_length_is_invalid, group_add_fixture)
+    {
+      bin[17] = 0x08;
+      auto it = bin.begin();
+
+      auto const result = v13::try_decode<msg::group_add>(it, bin.end());
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type()
+              == v13::exception::ex_error_type::bad_bucket);
+      BOOST_TEST(result.error().error_code()
+              == v13::exception::ex_error_code::bad_length);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
 BOOST_AUTO_TEST_SUITE_END() // group_add
 
 BOOST_AUTO_TEST_SUITE(group_delete)
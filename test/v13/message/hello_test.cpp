@@ -1,6 +1,7 @@
 #define BOOST_TEST_DYN_LINK
 #include <canard/net/ofp/v13/message/hello.hpp>
 #include <boost/test/unit_test.hpp>
+#include <canard/net/ofp/v13/try_decode.hpp>
 
 #include <cstdint>
 #include <type_traits>
@@ -203,5 +204,29 @@ BOOST_AUTO_TEST_SUITE(hello)
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
 
+  BOOST_AUTO_TEST_SUITE(try_decode)
+    BOOST_FIXTURE_TEST_CASE(constructs_hello_from_binary, hello_fixture)
+    {
+      auto it = bin.begin();
+
+      auto const result = v13::try_decode<msg::hello>(it, bin.end());
+
+      BOOST_TEST_REQUIRE(bool(result));
+      BOOST_TEST((it == bin.end()));
+      BOOST_TEST((result.value() == sut));
+    }
+    BOOST_AUTO_TEST_CASE(returns_error_if_elements_length_is_invalid)
+    {
+      auto const bin = "\x04\x00\x00\x0b\x12\x34\x56\x78""\x00\x01\x00"_bin;
+      auto it = bin.begin();
+
+      auto const result = v13::try_decode<msg::hello>(it, bin.end());
+
+      BOOST_TEST(!result);
+      BOOST_TEST(result.error().error_type() == protocol::OFPET_BAD_REQUEST);
+      BOOST_TEST(result.error().error_code() == protocol::OFPBRC_BAD_LEN);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // try_decode
+
 BOOST_AUTO_TEST_SUITE_END() // hello
 BOOST_AUTO_TEST_SUITE_END() // message_test
@@ -351,6 +351,78 @@ BOOST_AUTO_TEST_SUITE(packet_in)
       BOOST_TEST((frame == org_packet_in.frame()));
     }
   BOOST_AUTO_TEST_SUITE_END() // extract_frame
+
+  BOOST_FIXTURE_TEST_SUITE(view, packet_in_fixture)
+    BOOST_AUTO_TEST_CASE(refers_frame_in_binary)
+    {
+      unsigned char const* it = bin.data();
+
+      auto const view = v13::messages::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      BOOST_TEST((it == bin.data() + bin.size()));
+      BOOST_TEST(view.xid() == sut.xid());
+      BOOST_TEST(view.length() == sut.length());
+      BOOST_TEST(view.buffer_id() == sut.buffer_id());
+      BOOST_TEST(view.total_length() == sut.total_length());
+      BOOST_TEST(view.reason() == sut.reason());
+      BOOST_TEST(view.table_id() == sut.table_id());
+      BOOST_TEST(view.cookie() == sut.cookie());
+      BOOST_TEST(view.frame_length() == sut.frame_length());
+      BOOST_TEST((view.frame().end() == bin.data() + bin.size()));
+    }
+    BOOST_AUTO_TEST_CASE(decodes_match_lazily)
+    {
+      unsigned char const* it = bin.data();
+
+      auto const view = v13::messages::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      BOOST_TEST(view.in_port() == sut.in_port());
+      BOOST_TEST((view.match().to_oxm_match() == sut.match()));
+    }
+    BOOST_AUTO_TEST_CASE(packet_in_is_constructible_from_view)
+    {
+      unsigned char const* it = bin.data();
+      auto const view = v13::messages::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      auto const packet_in = v13::messages::packet_in{view};
+
+      BOOST_TEST((packet_in == sut));
+    }
+    BOOST_FIXTURE_TEST_CASE(refers_empty_frame, no_data_packet_in)
+    {
+      unsigned char const* it = bin.data();
+
+      auto const view = v13::messages::packet_in_view::decode(
+          it, bin.data() + bin.size());
+
+      BOOST_TEST((it == bin.data() + bin.size()));
+      BOOST_TEST(view.frame().empty());
+      BOOST_TEST(view.in_port() == 1);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_length)
+    {
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            v13::messages::packet_in_view::decode(
+              it, bin.data() + bin.size() - 1)
+          , v13::exception);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_packet_in)
+    {
+      auto const truncated = std::vector<unsigned char>(
+          bin.begin(), bin.begin() + sizeof(protocol::ofp_header));
+      unsigned char const* it = truncated.data();
+
+      BOOST_CHECK_THROW(
+            v13::messages::packet_in_view::decode(
+              it, truncated.data() + truncated.size())
+          , v13::exception);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // view
 BOOST_AUTO_TEST_SUITE_END() // packet_in
 BOOST_AUTO_TEST_SUITE_END() // message_test
 
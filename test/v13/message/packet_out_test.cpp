@@ -2,6 +2,11 @@
 #include <canard/net/ofp/v13/message/packet_out.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <cstddef>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+#include <canard/net/ofp/gather_buffer.hpp>
+
 #include "../../test_utility.hpp"
 
 namespace of = canard::net::ofp;
@@ -13,8 +18,18 @@ namespace {
 
   constexpr auto ofp_pkt_out_size = sizeof(protocol::ofp_packet_out);
 
+  template <class ConstBufferSequence>
+  auto to_vector(ConstBufferSequence const& buffers)
+    -> std::vector<std::uint8_t>
+  {
+    auto bytes = std::vector<std::uint8_t>(boost::asio::buffer_size(buffers));
+    boost::asio::buffer_copy(boost::asio::buffer(bytes), buffers);
+    return bytes;
+  }
+
   struct packet_out_parameter {
-    v13::messages::packet_out::data_type data = "\x10\x11\x12\x13\x14\x15"_bbin;
+    using data_type = v13::messages::packet_out::data_type;
+    data_type data = "\x10\x11\x12\x13\x14\x15"_bbin;
     std::uint32_t in_port = protocol::OFPP_CONTROLLER;
     v13::actions::push_vlan push_vlan{0x8100};
     v13::actions::set_vlan_vid set_vlan_vid{protocol::OFPVID_PRESENT | 3};
@@ -224,6 +239,42 @@ BOOST_AUTO_TEST_SUITE(packet_out)
       BOOST_TEST(buffer.size() == sut.byte_length());
       BOOST_TEST(buffer == bin, boost::test_tools::per_element{});
     }
+    BOOST_FIXTURE_TEST_CASE(
+        copy_small_frame_to_gather_buffer, packet_out_fixture)
+    {
+      auto buffer = of::gather_buffer{};
+
+      sut.encode(buffer);
+
+      auto const buffers = buffer.buffers();
+      BOOST_TEST(buffers.size() == 1);
+      BOOST_TEST(buffer.size() == sut.byte_length());
+      BOOST_TEST(buffer.scratch_size() == sut.byte_length());
+      BOOST_TEST(to_vector(buffers) == bin, boost::test_tools::per_element{});
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        refer_to_large_frame_from_gather_buffer, packet_out_parameter)
+    {
+      auto const frame_length = std::size_t{9000};
+      auto const sut = v13::messages::packet_out{
+        data_type(frame_length, 0xa5), in_port, actions, xid
+      };
+      auto expected = std::vector<std::uint8_t>{};
+      sut.encode(expected);
+      auto buffer = of::gather_buffer{};
+
+      sut.encode(buffer);
+
+      auto const buffers = buffer.buffers();
+      BOOST_TEST_REQUIRE(buffers.size() == 2);
+      BOOST_TEST(boost::asio::buffer_cast<unsigned char const*>(buffers[1])
+              == sut.frame().data());
+      BOOST_TEST(boost::asio::buffer_size(buffers[1]) == frame_length);
+      BOOST_TEST(buffer.size() == sut.byte_length());
+      BOOST_TEST(buffer.scratch_size() == sut.byte_length() - frame_length);
+      BOOST_TEST(to_vector(buffers) == expected
+               , boost::test_tools::per_element{});
+    }
   BOOST_AUTO_TEST_SUITE_END() // encode
 
   BOOST_AUTO_TEST_SUITE(decode)
@@ -789,6 +789,132 @@ BOOST_AUTO_TEST_SUITE(flow_stats_reply)
       BOOST_TEST((flow_stats_reply == sut));
     }
   BOOST_AUTO_TEST_SUITE_END() // decode
+
+  BOOST_FIXTURE_TEST_SUITE(view, flow_stats_reply_fixture)
+    BOOST_AUTO_TEST_CASE(refers_to_header_and_counts_elements)
+    {
+      unsigned char const* it = bin.data();
+
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, bin.data() + bin.size());
+
+      BOOST_TEST((it == bin.data() + bin.size()));
+      BOOST_TEST(view.xid() == sut.xid());
+      BOOST_TEST(view.length() == sut.length());
+      BOOST_TEST(view.flags() == sut.flags());
+      BOOST_TEST(view.size() == sut.body().size());
+      BOOST_TEST(std::distance(view.begin(), view.end()) == 6);
+    }
+    BOOST_AUTO_TEST_CASE(decodes_elements_one_at_a_time)
+    {
+      unsigned char const* it = bin.data();
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, bin.data() + bin.size());
+
+      for (auto const& flow_stats : view) {
+        BOOST_TEST(flow_stats.length() == this->flow_stats.length());
+        BOOST_TEST(flow_stats.priority() == this->flow_stats.priority());
+        BOOST_TEST(flow_stats.cookie() == this->flow_stats.cookie());
+        BOOST_TEST(flow_stats.table_id() == this->flow_stats.table_id());
+        BOOST_TEST(flow_stats.packet_count()
+                == this->flow_stats.packet_count());
+        BOOST_TEST(flow_stats.match().contains<match::eth_dst>());
+        BOOST_TEST((flow_stats.match().to_oxm_match()
+                 == this->flow_stats.match()));
+        BOOST_TEST((flow_stats.instructions()
+                 == this->flow_stats.instructions()));
+      }
+    }
+    BOOST_AUTO_TEST_CASE(flow_stats_is_constructible_from_element_view)
+    {
+      unsigned char const* it = bin.data();
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, bin.data() + bin.size());
+
+      auto const flow_stats = multipart::flow_stats{*view.begin()};
+
+      BOOST_TEST((flow_stats == this->flow_stats));
+    }
+    BOOST_AUTO_TEST_CASE(has_no_element_if_body_is_empty)
+    {
+      auto buffer = std::vector<unsigned char>{};
+      multipart::flow_stats_reply{body_type{}, 0, xid}.encode(buffer);
+      unsigned char const* it = buffer.data();
+
+      auto const view = multipart::flow_stats_reply_view::decode(
+          it, buffer.data() + buffer.size());
+
+      BOOST_TEST(view.empty());
+      BOOST_TEST((view.begin() == view.end()));
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_length)
+    {
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            multipart::flow_stats_reply_view::decode(
+              it, bin.data() + bin.size() - 1)
+          , v13::exception);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_element_length_is_too_small)
+    {
+      bin[16 + 184] = 0x00;
+      bin[16 + 185] = 0x08;
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            multipart::flow_stats_reply_view::decode(
+              it, bin.data() + bin.size())
+          , v13::exception);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_element_overruns_body)
+    {
+      bin[16 + 5 * 184] = 0x01;
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            multipart::flow_stats_reply_view::decode(
+              it, bin.data() + bin.size())
+          , v13::exception);
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_version_is_invalid)
+    {
+      bin[0] = 0x01;
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_EXCEPTION(
+            multipart::flow_stats_reply_view::decode(
+              it, bin.data() + bin.size())
+          , v13::exception
+          , [](v13::exception const& e) {
+              return e.error_type() == protocol::error_type::bad_request
+                  && e.error_code() == protocol::bad_request_code::bad_version;
+            });
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_message_type_is_invalid)
+    {
+      bin[1] = protocol::OFPT_MULTIPART_REQUEST;
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_EXCEPTION(
+            multipart::flow_stats_reply_view::decode(
+              it, bin.data() + bin.size())
+          , v13::exception
+          , [](v13::exception const& e) {
+              return e.error_type() == protocol::error_type::bad_request
+                  && e.error_code() == protocol::bad_request_code::bad_type;
+            });
+    }
+    BOOST_AUTO_TEST_CASE(throw_exception_if_binary_is_smaller_than_header)
+    {
+      unsigned char const* it = bin.data();
+
+      BOOST_CHECK_THROW(
+            multipart::flow_stats_reply_view::decode(it, bin.data() + 15)
+          , v13::exception);
+      BOOST_TEST((it == bin.data()));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // view
 BOOST_AUTO_TEST_SUITE_END() // flow_stats_reply
 
 BOOST_AUTO_TEST_SUITE_END() // multipart_test
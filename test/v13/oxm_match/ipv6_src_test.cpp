@@ -190,6 +190,22 @@ BOOST_AUTO_TEST_SUITE(ipv6_src_test)
         BOOST_TEST(sut.is_exact());
     }
 
+    BOOST_AUTO_TEST_CASE(stores_wire_value_and_mask_inline_test)
+    {
+        BOOST_TEST(sizeof(match::ipv6_src) == 2 * 16 + sizeof(bool));
+    }
+
+    BOOST_AUTO_TEST_CASE(address_scope_id_is_not_kept_test)
+    {
+        auto value = "fe80::1"_ipv6;
+        value.scope_id(3);
+
+        auto const sut = match::ipv6_src{value};
+
+        BOOST_TEST(sut.oxm_value() == "fe80::1"_ipv6);
+        BOOST_TEST((sut == match::ipv6_src{"fe80::1"_ipv6}));
+    }
+
     BOOST_AUTO_TEST_SUITE(equality)
       BOOST_AUTO_TEST_CASE(true_if_value_is_same_and_no_mask)
       {
@@ -1,9 +1,12 @@
 #define BOOST_TEST_DYN_LINK
 #include <canard/net/ofp/v13/action_list.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
+#include <canard/net/ofp/memory_resource.hpp>
 #include <canard/net/ofp/v13/actions.hpp>
 
 #include "../../test_utility.hpp"
@@ -35,6 +38,25 @@ struct action_list_fixture
           "\xff\xff\x00\x00\x00\x00\x00\x00"_bin;
 };
 
+class recording_resource
+    : public of::memory_resource
+{
+public:
+    std::vector<std::size_t> allocated_sizes;
+
+private:
+    auto do_allocate(std::size_t const bytes, std::size_t) -> void* override
+    {
+        allocated_sizes.push_back(bytes);
+        return ::operator new(bytes);
+    }
+
+    void do_deallocate(void* const ptr, std::size_t, std::size_t) override
+    {
+        ::operator delete(ptr);
+    }
+};
+
 }
 
 BOOST_AUTO_TEST_SUITE(common_type_test)
@@ -247,7 +269,183 @@ BOOST_AUTO_TEST_SUITE(action_list_test)
 
         BOOST_TEST((it == it_end));
         BOOST_TEST((match_set == sut));
+        BOOST_TEST(match_set.length() == binary.size());
     }
 
+    BOOST_FIXTURE_TEST_CASE(
+        decode_allocates_exact_number_of_actions, action_list_fixture)
+    {
+        recording_resource resource{};
+        auto it = binary.begin();
+
+        auto const action_list = [&]{
+            of::scoped_memory_resource const scope{resource};
+            return v13::action_list::decode(it, binary.end());
+        }();
+
+        BOOST_TEST(action_list.size() == 6);
+        BOOST_TEST_REQUIRE(resource.allocated_sizes.size() == 1);
+        BOOST_TEST(resource.allocated_sizes[0] == 6 * sizeof(v13::any_action));
+    }
+
+    BOOST_AUTO_TEST_SUITE(length)
+      BOOST_AUTO_TEST_CASE(is_updated_by_push_back_and_pop_back)
+      {
+        auto sut = v13::action_list{ actions::copy_ttl_in{} };
+
+        sut.push_back(actions::set_ipv4_src{"127.0.0.1"_ipv4});
+        sut.emplace_back(actions::output{1});
+
+        BOOST_TEST(sut.length() == 8 + 16 + 16);
+
+        sut.pop_back();
+
+        BOOST_TEST(sut.length() == 8 + 16);
+      }
+      BOOST_AUTO_TEST_CASE(is_updated_by_insert_and_erase)
+      {
+        auto sut = v13::action_list{
+          actions::copy_ttl_in{}, actions::copy_ttl_out{}
+        };
+
+        auto const it = sut.insert(
+            sut.cbegin() + 1, actions::output{1}, actions::group{2});
+
+        BOOST_TEST(sut.length() == 8 + 16 + 8 + 8);
+
+        sut.erase(it);
+
+        BOOST_TEST(sut.length() == 8 + 8 + 8);
+
+        sut.erase(sut.cbegin(), sut.cbegin() + 2);
+
+        BOOST_TEST(sut.length() == 8);
+      }
+      BOOST_AUTO_TEST_CASE(is_updated_by_assign_and_clear)
+      {
+        auto sut = v13::action_list{ actions::copy_ttl_in{} };
+
+        sut.assign(3, v13::any_action{actions::output{1}});
+
+        BOOST_TEST(sut.length() == 3 * 16);
+
+        sut.clear();
+
+        BOOST_TEST(sut.length() == 0);
+      }
+      BOOST_AUTO_TEST_CASE(reflects_change_through_element_access)
+      {
+        auto sut = v13::action_list{
+          actions::copy_ttl_in{}, actions::copy_ttl_out{}
+        };
+
+        sut[0] = actions::output{1};
+
+        BOOST_TEST(sut.length() == 16 + 8);
+
+        sut.push_back(actions::group{1});
+
+        BOOST_TEST(sut.length() == 16 + 8 + 8);
+      }
+      BOOST_AUTO_TEST_CASE(reflects_change_through_kept_reference)
+      {
+        auto sut = v13::action_list{
+          actions::copy_ttl_in{}, actions::copy_ttl_out{}
+        };
+        sut.reserve(3);
+        auto& front = sut.front();
+        sut.push_back(actions::group{1});
+
+        front = actions::output{1};
+
+        BOOST_TEST(sut.length() == 16 + 8 + 8);
+      }
+      BOOST_AUTO_TEST_CASE(is_recomputed_after_sort)
+      {
+        auto sut = v13::action_list{
+          actions::output{1}, actions::copy_ttl_in{}
+        };
+
+        std::sort(sut.begin(), sut.end()
+            , [](v13::any_action const& lhs, v13::any_action const& rhs)
+              { return lhs.length() < rhs.length(); });
+
+        BOOST_TEST(sut.length() == 8 + 16);
+        BOOST_TEST(sut.front().length() == 8);
+      }
+      BOOST_AUTO_TEST_CASE(is_updated_by_splice)
+      {
+        auto sut = v13::action_list{ actions::copy_ttl_in{} };
+        auto other = v13::action_list{
+          actions::output{1}, actions::group{2}
+        };
+
+        sut.splice(sut.cend(), other, other.cbegin(), other.cbegin() + 1);
+
+        BOOST_TEST(sut.length() == 8 + 16);
+        BOOST_TEST(other.length() == 8);
+
+        sut.splice(sut.cbegin(), other);
+
+        BOOST_TEST((sut == v13::action_list{
+              actions::group{2}, actions::copy_ttl_in{}, actions::output{1}
+        }));
+        BOOST_TEST(sut.length() == 8 + 8 + 16);
+        BOOST_TEST(other.empty());
+        BOOST_TEST(other.length() == 0);
+      }
+      BOOST_AUTO_TEST_CASE(is_unchanged_by_splice_into_itself)
+      {
+        auto sut = v13::action_list{
+          actions::output{1}, actions::group{2}, actions::copy_ttl_in{}
+        };
+
+        sut.splice(sut.cbegin(), sut);
+
+        BOOST_TEST((sut == v13::action_list{
+              actions::output{1}, actions::group{2}, actions::copy_ttl_in{}
+        }));
+        BOOST_TEST(sut.length() == 16 + 8 + 8);
+
+        sut.splice(sut.cbegin(), sut, sut.cbegin() + 1, sut.cend());
+
+        BOOST_TEST((sut == v13::action_list{
+              actions::group{2}, actions::copy_ttl_in{}, actions::output{1}
+        }));
+        BOOST_TEST(sut.length() == 8 + 8 + 16);
+
+        sut.splice(sut.cend(), sut, sut.cbegin(), sut.cbegin() + 1);
+
+        BOOST_TEST((sut == v13::action_list{
+              actions::copy_ttl_in{}, actions::output{1}, actions::group{2}
+        }));
+        BOOST_TEST(sut.length() == 8 + 16 + 8);
+      }
+      BOOST_AUTO_TEST_CASE(is_updated_by_replace)
+      {
+        auto sut = v13::action_list{
+          actions::copy_ttl_in{}, actions::group{2}
+        };
+
+        auto const it = sut.replace(sut.cbegin(), actions::output{1});
+
+        BOOST_TEST((it == sut.cbegin()));
+        BOOST_TEST((sut == v13::action_list{
+              actions::output{1}, actions::group{2}
+        }));
+        BOOST_TEST(sut.length() == 16 + 8);
+      }
+      BOOST_AUTO_TEST_CASE(is_zero_after_moved_from)
+      {
+        auto sut = v13::action_list{ actions::output{1} };
+
+        auto const moved = std::move(sut);
+
+        BOOST_TEST(moved.length() == 16);
+        BOOST_TEST(sut.length() == 0);
+        BOOST_TEST(sut.empty());
+      }
+    BOOST_AUTO_TEST_SUITE_END() // length
+
 BOOST_AUTO_TEST_SUITE_END() // action_list_test
 BOOST_AUTO_TEST_SUITE_END() // common_type_test
@@ -0,0 +1,97 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/allocation_stats.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <typeinfo>
+#include <boost/container/vector.hpp>
+#include <canard/net/ofp/data_type.hpp>
+
+namespace ofp = canard::net::ofp;
+
+namespace {
+  struct tag1 {};
+  struct tag2 {};
+  struct tag3 {};
+
+  template <class Tag>
+  auto counter()
+    -> ofp::allocation_stats_detail::counter&
+  {
+    return ofp::allocation_stats_detail::counter_of<Tag>();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(allocation_stats)
+
+  BOOST_AUTO_TEST_CASE(is_zero_if_nothing_is_allocated)
+  {
+    auto const stats = ofp::get_allocation_stats<tag3>();
+
+    BOOST_TEST(stats.allocations == 0);
+    BOOST_TEST(stats.deallocations == 0);
+    BOOST_TEST(stats.allocated_bytes == 0);
+    BOOST_TEST(stats.live_bytes == 0);
+    BOOST_TEST(stats.peak_live_bytes == 0);
+  }
+  BOOST_AUTO_TEST_CASE(counts_allocations_per_tag)
+  {
+    counter<tag1>().allocate(4 * sizeof(std::uint32_t));
+    counter<tag1>().allocate(8 * sizeof(std::uint32_t));
+    {
+      auto const stats = ofp::get_allocation_stats<tag1>();
+      BOOST_TEST(stats.allocations == 2);
+      BOOST_TEST(stats.deallocations == 0);
+      BOOST_TEST(stats.allocated_bytes == 12 * sizeof(std::uint32_t));
+      BOOST_TEST(stats.live_bytes == 12 * sizeof(std::uint32_t));
+      BOOST_TEST(ofp::get_allocation_stats<tag2>().allocations == 0);
+    }
+
+    counter<tag1>().deallocate(4 * sizeof(std::uint32_t));
+    counter<tag1>().deallocate(8 * sizeof(std::uint32_t));
+
+    auto const stats = ofp::get_allocation_stats<tag1>();
+    BOOST_TEST(stats.deallocations == 2);
+    BOOST_TEST(stats.live_bytes == 0);
+    BOOST_TEST(stats.peak_live_bytes == 12 * sizeof(std::uint32_t));
+  }
+  BOOST_AUTO_TEST_CASE(reset_keeps_live_bytes)
+  {
+    counter<tag2>().allocate(4 * sizeof(std::uint32_t));
+
+    ofp::reset_allocation_stats<tag2>();
+
+    auto const stats = ofp::get_allocation_stats<tag2>();
+    BOOST_TEST(stats.allocations == 0);
+    BOOST_TEST(stats.allocated_bytes == 0);
+    BOOST_TEST(stats.live_bytes == 4 * sizeof(std::uint32_t));
+    BOOST_TEST(stats.peak_live_bytes == 4 * sizeof(std::uint32_t));
+    counter<tag2>().deallocate(4 * sizeof(std::uint32_t));
+  }
+  BOOST_AUTO_TEST_CASE(enumerates_counted_types)
+  {
+    counter<tag1>().allocate(sizeof(std::uint32_t));
+    auto found = false;
+
+    ofp::for_each_allocation_stats(
+        [&](char const* name, ofp::allocation_stats const& stats) {
+          if (std::strcmp(name, typeid(tag1).name()) == 0) {
+            found = stats.live_bytes == sizeof(std::uint32_t);
+          }
+        });
+
+    BOOST_TEST(found);
+    counter<tag1>().deallocate(sizeof(std::uint32_t));
+  }
+  BOOST_AUTO_TEST_CASE(data_type_does_not_depend_on_instrumentation)
+  {
+    BOOST_TEST((std::is_same<
+          ofp::data_type, boost::container::vector<std::uint8_t>
+    >::value));
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // allocation_stats
+BOOST_AUTO_TEST_SUITE_END() // utility_test
@@ -2,6 +2,9 @@
 #include <canard/net/ofp/v13/any_action.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -36,6 +39,22 @@ BOOST_AUTO_TEST_SUITE(any_action_test)
 
       BOOST_TEST(min_byte_length::value == 8);
     }
+    BOOST_AUTO_TEST_CASE(for_each_alternative_size)
+    {
+      using sut = v13::any_action;
+      auto num_alternatives = std::size_t{0};
+      auto max_size = std::size_t{0};
+
+      sut::for_each_alternative_size(
+          [&](char const*, std::size_t const size) {
+            ++num_alternatives;
+            max_size = std::max(max_size, size);
+          });
+
+      BOOST_TEST(num_alternatives == std::tuple_size<sut::type_list>::value);
+      BOOST_TEST(max_size == sizeof(actions::set_ipv6_src));
+      BOOST_TEST(sizeof(sut) < max_size + alignof(sut) + 1);
+    }
   BOOST_AUTO_TEST_SUITE_END() // type_test
 
   BOOST_AUTO_TEST_SUITE(constructor)
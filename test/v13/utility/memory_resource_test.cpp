@@ -0,0 +1,172 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/memory_resource.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/io/openflow.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace fields = v13::oxm_match_fields;
+
+namespace {
+
+  struct oxm_match_fixture
+  {
+    v13::oxm_match match{
+      fields::in_port{1}, fields::eth_type{0x0800}, fields::ip_proto{6}
+    };
+    std::vector<unsigned char> binary;
+
+    oxm_match_fixture()
+    {
+      match.encode(binary);
+    }
+  };
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(memory_resource)
+
+  BOOST_AUTO_TEST_SUITE(monotonic_buffer_resource)
+    BOOST_AUTO_TEST_CASE(allocates_aligned_memory_from_initial_buffer)
+    {
+      alignas(16) unsigned char buffer[64];
+      ofp::monotonic_buffer_resource sut{buffer, sizeof(buffer)};
+
+      auto const p1 = static_cast<unsigned char*>(sut.allocate(3, 1));
+      auto const p2 = static_cast<unsigned char*>(sut.allocate(8, 8));
+
+      BOOST_TEST(p1 == buffer);
+      BOOST_TEST(p2 == buffer + 8);
+    }
+    BOOST_AUTO_TEST_CASE(allocates_new_chunk_if_buffer_is_exhausted)
+    {
+      alignas(16) unsigned char buffer[16];
+      ofp::monotonic_buffer_resource sut{buffer, sizeof(buffer)};
+
+      auto const p1 = static_cast<unsigned char*>(sut.allocate(16, 1));
+      auto const p2 = static_cast<unsigned char*>(sut.allocate(256, 16));
+
+      BOOST_TEST(p1 == buffer);
+      BOOST_TEST((p2 < buffer || p2 >= buffer + sizeof(buffer)));
+      BOOST_TEST(reinterpret_cast<std::uintptr_t>(p2) % 16 == 0);
+    }
+    BOOST_AUTO_TEST_CASE(release_rewinds_to_initial_buffer)
+    {
+      alignas(16) unsigned char buffer[16];
+      ofp::monotonic_buffer_resource sut{buffer, sizeof(buffer)};
+      sut.allocate(16, 1);
+      sut.allocate(1024, 1);
+
+      sut.release();
+
+      BOOST_TEST(sut.allocate(1, 1) == buffer);
+    }
+  BOOST_AUTO_TEST_SUITE_END() // monotonic_buffer_resource
+
+  BOOST_AUTO_TEST_SUITE(scoped_memory_resource)
+    BOOST_AUTO_TEST_CASE(replaces_current_resource_in_scope)
+    {
+      ofp::monotonic_buffer_resource arena1{};
+      ofp::monotonic_buffer_resource arena2{};
+
+      BOOST_TEST(ofp::current_memory_resource() == nullptr);
+      {
+        ofp::scoped_memory_resource const scope1{arena1};
+        BOOST_TEST(ofp::current_memory_resource() == &arena1);
+        {
+          ofp::scoped_memory_resource const scope2{arena2};
+          BOOST_TEST(ofp::current_memory_resource() == &arena2);
+        }
+        BOOST_TEST(ofp::current_memory_resource() == &arena1);
+      }
+      BOOST_TEST(ofp::current_memory_resource() == nullptr);
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        nested_lists_are_decoded_into_current_resource, oxm_match_fixture)
+    {
+      ofp::monotonic_buffer_resource arena{};
+      ofp::scoped_memory_resource const scope{arena};
+      auto it = binary.begin();
+
+      auto const decoded = v13::oxm_match::decode(it, binary.end());
+
+      BOOST_TEST(decoded.oxm_fields().get_allocator().resource() == &arena);
+      BOOST_TEST((decoded == match));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        copy_out_of_scope_does_not_refer_resource, oxm_match_fixture)
+    {
+      ofp::monotonic_buffer_resource arena{};
+      auto decoded = [&]{
+        ofp::scoped_memory_resource const scope{arena};
+        auto it = binary.begin();
+        return v13::oxm_match::decode(it, binary.end());
+      }();
+
+      auto const copy = decoded;
+      auto const moved = std::move(decoded);
+
+      BOOST_TEST(copy.oxm_fields().get_allocator().resource() == nullptr);
+      BOOST_TEST(moved.oxm_fields().get_allocator().resource() == &arena);
+      BOOST_TEST((copy == match));
+    }
+    BOOST_FIXTURE_TEST_CASE(
+        move_assignment_keeps_resource_of_target, oxm_match_fixture)
+    {
+      ofp::monotonic_buffer_resource arena{};
+      auto decoded = [&]{
+        ofp::scoped_memory_resource const scope{arena};
+        auto it = binary.begin();
+        return v13::oxm_match::decode(it, binary.end());
+      }();
+      auto sut = v13::oxm_match{};
+
+      sut = std::move(decoded);
+
+      BOOST_TEST(sut.oxm_fields().get_allocator().resource() == nullptr);
+      BOOST_TEST((sut == match));
+    }
+    BOOST_FIXTURE_TEST_CASE(swap_keeps_resources, oxm_match_fixture)
+    {
+      ofp::monotonic_buffer_resource arena{};
+      auto decoded = [&]{
+        ofp::scoped_memory_resource const scope{arena};
+        auto it = binary.begin();
+        return v13::oxm_match::decode(it, binary.end());
+      }();
+      auto const other = v13::oxm_match{fields::in_port{2}};
+      auto sut = other;
+
+      sut.swap(decoded);
+
+      BOOST_TEST(sut.oxm_fields().get_allocator().resource() == nullptr);
+      BOOST_TEST(decoded.oxm_fields().get_allocator().resource() == &arena);
+      BOOST_TEST((sut == match));
+      BOOST_TEST((decoded == other));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // scoped_memory_resource
+
+  BOOST_AUTO_TEST_SUITE(explicit_allocator)
+    BOOST_FIXTURE_TEST_CASE(
+        list_is_allocated_from_given_resource, oxm_match_fixture)
+    {
+      using oxm_fields_type = v13::oxm_match::oxm_fields_type;
+      ofp::monotonic_buffer_resource arena{};
+      auto sut = oxm_fields_type{oxm_fields_type::allocator_type{&arena}};
+
+      sut.assign(match.oxm_fields().begin(), match.oxm_fields().end());
+
+      BOOST_TEST(sut.get_allocator().resource() == &arena);
+      BOOST_TEST((sut == match.oxm_fields()));
+    }
+  BOOST_AUTO_TEST_SUITE_END() // explicit_allocator
+
+BOOST_AUTO_TEST_SUITE_END() // memory_resource
+BOOST_AUTO_TEST_SUITE_END() // utility_test
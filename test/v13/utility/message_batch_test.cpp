@@ -0,0 +1,146 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/message_batch.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <boost/asio/buffer.hpp>
+#include <canard/net/ofp/v13/message/barrier.hpp>
+#include <canard/net/ofp/v13/message/echo.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace msg = v13::messages;
+
+namespace {
+  struct message_batch_fixture
+  {
+    ofp::message_batch sut{v13::protocol::OFP_VERSION};
+    msg::echo_request echo_request{"\x01\x02\x03"_bbin, 0x05060708};
+    std::vector<unsigned char> echo_request_bin
+      = "\x04\x02\x00\x0b\x05\x06\x07\x08""\x01\x02\x03"_bin;
+    msg::barrier_reply barrier_reply{0x01020304};
+    std::vector<unsigned char> barrier_reply_bin
+      = "\x04\x15\x00\x08\x01\x02\x03\x04"_bin;
+  };
+
+  auto concat(
+      std::vector<unsigned char> lhs, std::vector<unsigned char> const& rhs)
+    -> std::vector<unsigned char>
+  {
+    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+    return lhs;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_FIXTURE_TEST_SUITE(message_batch, message_batch_fixture)
+  BOOST_AUTO_TEST_CASE(is_empty_when_constructed)
+  {
+    BOOST_TEST(sut.empty());
+    BOOST_TEST(sut.size() == 0);
+    BOOST_TEST(sut.byte_length() == 0);
+    BOOST_TEST(sut.num_chunks() == 0);
+    BOOST_TEST(sut.buffers().empty());
+  }
+  BOOST_AUTO_TEST_CASE(encodes_messages_back_to_back)
+  {
+    auto const xid1 = sut.push_back(echo_request);
+    auto const xid2 = sut.push_back(barrier_reply);
+
+    BOOST_TEST(xid1 == echo_request.xid());
+    BOOST_TEST(xid2 == barrier_reply.xid());
+    BOOST_TEST(sut.size() == 2);
+    BOOST_TEST(sut.byte_length() == 19);
+    BOOST_TEST_REQUIRE(sut.num_chunks() == 1);
+    BOOST_TEST(sut.chunk(0) == concat(echo_request_bin, barrier_reply_bin)
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(assigns_consecutive_xids)
+  {
+    sut.assign_xids_from(0x11121314);
+
+    auto const xid1 = sut.push_back(echo_request);
+    auto const xid2 = sut.push_back(barrier_reply);
+
+    BOOST_TEST(xid1 == 0x11121314);
+    BOOST_TEST(xid2 == 0x11121315);
+    BOOST_TEST(sut.chunk(0)
+            == "\x04\x02\x00\x0b\x11\x12\x13\x14""\x01\x02\x03"
+               "\x04\x15\x00\x08\x11\x12\x13\x15"_bin
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(inserts_barrier_request_every_n_messages)
+  {
+    sut.assign_xids_from(1);
+    sut.insert_barrier_every(2);
+
+    sut.push_back(barrier_reply);
+    sut.push_back(barrier_reply);
+    sut.push_back(barrier_reply);
+
+    BOOST_TEST(sut.size() == 4);
+    BOOST_TEST(sut.byte_length() == 32);
+    BOOST_TEST(sut.chunk(0)
+            == "\x04\x15\x00\x08\x00\x00\x00\x01"
+               "\x04\x15\x00\x08\x00\x00\x00\x02"
+               "\x04\x14\x00\x08\x00\x00\x00\x03"
+               "\x04\x15\x00\x08\x00\x00\x00\x04"_bin
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(does_not_split_message_across_chunks)
+  {
+    auto sut = ofp::message_batch{v13::protocol::OFP_VERSION, 20};
+
+    sut.push_back(barrier_reply);
+    sut.push_back(echo_request);
+    sut.push_back(barrier_reply);
+
+    BOOST_TEST(sut.size() == 3);
+    BOOST_TEST(sut.byte_length() == 27);
+    BOOST_TEST_REQUIRE(sut.num_chunks() == 2);
+    BOOST_TEST(sut.chunk(0) == concat(barrier_reply_bin, echo_request_bin)
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.chunk(1) == barrier_reply_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(boost::asio::buffer_size(sut.buffers()) == sut.byte_length());
+  }
+  BOOST_AUTO_TEST_CASE(puts_message_larger_than_chunk_size_in_own_chunk)
+  {
+    auto sut = ofp::message_batch{v13::protocol::OFP_VERSION, 8};
+
+    sut.push_back(echo_request);
+    sut.push_back(barrier_reply);
+
+    BOOST_TEST_REQUIRE(sut.num_chunks() == 2);
+    BOOST_TEST(sut.chunk(0) == echo_request_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.chunk(1) == barrier_reply_bin
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(clear_keeps_xid_assignment)
+  {
+    sut.assign_xids_from(1);
+    sut.push_back(echo_request);
+
+    sut.clear();
+    auto const xid = sut.push_back(barrier_reply);
+
+    BOOST_TEST(xid == 2);
+    BOOST_TEST(sut.size() == 1);
+    BOOST_TEST(sut.byte_length() == 8);
+    BOOST_TEST_REQUIRE(sut.num_chunks() == 1);
+    BOOST_TEST(sut.chunk(0) == "\x04\x15\x00\x08\x00\x00\x00\x02"_bin
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_message_version_is_different)
+  {
+    auto sut = ofp::message_batch{0x01};
+
+    BOOST_CHECK_THROW(sut.push_back(barrier_reply), std::invalid_argument);
+    BOOST_TEST(sut.empty());
+  }
+BOOST_AUTO_TEST_SUITE_END() // message_batch
+BOOST_AUTO_TEST_SUITE_END() // utility_test
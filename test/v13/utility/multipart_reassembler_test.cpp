@@ -0,0 +1,191 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/utility/multipart_reassembler.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <canard/net/ofp/v13/message/multipart/port_stats.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace multipart = v13::messages::multipart;
+namespace protocol = v13::protocol;
+
+namespace {
+
+  using reassembler = v13::multipart_reassembler<multipart::port_stats_reply>;
+  using body_type = multipart::port_stats_reply::body_type;
+  using std::chrono::seconds;
+
+  auto make_port_stats(std::uint32_t const port_no)
+    -> multipart::port_stats
+  {
+    return multipart::port_stats{
+      port_no, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, v13::elapsed_time{1, 2}
+    };
+  }
+
+  auto make_reply(
+        std::uint32_t const xid, std::uint16_t const flags
+      , std::uint32_t const first_port_no, std::uint32_t const num_ports)
+    -> multipart::port_stats_reply
+  {
+    auto body = body_type{};
+    for (auto i = std::uint32_t{0}; i < num_ports; ++i) {
+      body.push_back(make_port_stats(first_port_no + i));
+    }
+    return multipart::port_stats_reply{std::move(body), flags, xid};
+  }
+
+  auto port_numbers(body_type const& body)
+    -> std::vector<std::uint32_t>
+  {
+    auto port_nos = std::vector<std::uint32_t>{};
+    for (auto const& port_stats : body) {
+      port_nos.push_back(port_stats.port_no());
+    }
+    return port_nos;
+  }
+
+  constexpr auto more = std::uint16_t{protocol::OFPMPF_REPLY_MORE};
+
+  struct reassembler_fixture
+  {
+    reassembler sut{seconds{5}};
+    reassembler::time_point now{};
+  };
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_FIXTURE_TEST_SUITE(multipart_reassembler, reassembler_fixture)
+
+  BOOST_AUTO_TEST_CASE(is_empty_when_constructed)
+  {
+    BOOST_TEST(sut.empty());
+    BOOST_TEST(sut.byte_length() == 0);
+    BOOST_TEST(sut.multipart_type() == protocol::OFPMP_PORT_STATS);
+  }
+  BOOST_AUTO_TEST_CASE(returns_body_of_single_reply)
+  {
+    auto const aggregate = sut.push(make_reply(1, 0, 1, 2), now);
+
+    BOOST_TEST_REQUIRE(bool(aggregate));
+    BOOST_TEST(aggregate->xid == 1);
+    BOOST_TEST(port_numbers(aggregate->body)
+            == (std::vector<std::uint32_t>{1, 2})
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.empty());
+  }
+  BOOST_AUTO_TEST_CASE(joins_bodies_in_arrival_order)
+  {
+    BOOST_TEST(!sut.push(make_reply(1, more, 1, 2), now));
+    BOOST_TEST(!sut.push(make_reply(1, more, 3, 1), now));
+    BOOST_TEST(sut.size() == 1);
+    BOOST_TEST(sut.byte_length() == 3 * sizeof(protocol::ofp_port_stats));
+
+    auto const aggregate = sut.push(make_reply(1, 0, 4, 2), now);
+
+    BOOST_TEST_REQUIRE(bool(aggregate));
+    BOOST_TEST(aggregate->xid == 1);
+    BOOST_TEST(port_numbers(aggregate->body)
+            == (std::vector<std::uint32_t>{1, 2, 3, 4, 5})
+             , boost::test_tools::per_element{});
+    BOOST_TEST(aggregate->body.byte_length()
+            == 5 * sizeof(protocol::ofp_port_stats));
+    BOOST_TEST(sut.empty());
+    BOOST_TEST(sut.byte_length() == 0);
+  }
+  BOOST_AUTO_TEST_CASE(keeps_interleaved_sequences_apart)
+  {
+    sut.push(make_reply(1, more, 1, 1), now);
+    sut.push(make_reply(2, more, 11, 1), now);
+    sut.push(make_reply(1, more, 2, 1), now);
+
+    auto const aggregate2 = sut.push(make_reply(2, 0, 12, 1), now);
+    auto const aggregate1 = sut.push(make_reply(1, 0, 3, 1), now);
+
+    BOOST_TEST_REQUIRE(bool(aggregate1));
+    BOOST_TEST(port_numbers(aggregate1->body)
+            == (std::vector<std::uint32_t>{1, 2, 3})
+             , boost::test_tools::per_element{});
+    BOOST_TEST_REQUIRE(bool(aggregate2));
+    BOOST_TEST(port_numbers(aggregate2->body)
+            == (std::vector<std::uint32_t>{11, 12})
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(keeps_reserved_capacity)
+  {
+    sut.reserve(1, 100, now);
+
+    sut.push(make_reply(1, more, 1, 2), now);
+    auto const aggregate = sut.push(make_reply(1, 0, 3, 2), now);
+
+    BOOST_TEST_REQUIRE(bool(aggregate));
+    BOOST_TEST(aggregate->body.size() == 4);
+    BOOST_TEST(aggregate->body.capacity() >= 100);
+  }
+  BOOST_AUTO_TEST_CASE(discards_sequences_after_timeout)
+  {
+    sut.push(make_reply(1, more, 1, 1), now);
+    sut.push(make_reply(2, more, 1, 1), now + seconds{3});
+
+    BOOST_TEST(sut.expire(now + seconds{4}) == 0);
+    BOOST_TEST(sut.expire(now + seconds{5}) == 1);
+    BOOST_TEST(!sut.contains(1));
+    BOOST_TEST(sut.contains(2));
+    BOOST_TEST(sut.byte_length() == sizeof(protocol::ofp_port_stats));
+  }
+  BOOST_AUTO_TEST_CASE(extends_deadline_on_each_reply)
+  {
+    sut.push(make_reply(1, more, 1, 1), now);
+    sut.push(make_reply(1, more, 2, 1), now + seconds{4});
+
+    BOOST_TEST(sut.expire(now + seconds{8}) == 0);
+    BOOST_TEST(sut.expire(now + seconds{9}) == 1);
+    BOOST_TEST(!sut.contains(1));
+  }
+  BOOST_AUTO_TEST_CASE(restarts_sequence_after_it_is_aborted)
+  {
+    sut.push(make_reply(1, more, 1, 1), now);
+
+    BOOST_TEST(sut.abort(1));
+    BOOST_TEST(!sut.abort(1));
+    auto const aggregate = sut.push(make_reply(1, 0, 2, 1), now);
+
+    BOOST_TEST_REQUIRE(bool(aggregate));
+    BOOST_TEST(port_numbers(aggregate->body)
+            == (std::vector<std::uint32_t>{2})
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_too_many_sequences)
+  {
+    auto sut = reassembler{seconds{5}, 2};
+    sut.push(make_reply(1, more, 1, 1), now);
+    sut.push(make_reply(2, more, 1, 1), now);
+
+    BOOST_CHECK_THROW(
+        sut.push(make_reply(3, more, 1, 1), now), std::length_error);
+    BOOST_TEST(sut.size() == 2);
+    BOOST_TEST(bool(sut.push(make_reply(3, 0, 1, 1), now)));
+  }
+  BOOST_AUTO_TEST_CASE(discards_sequence_if_it_exceeds_byte_length_limit)
+  {
+    auto sut = reassembler{
+      seconds{5}, 2, 3 * sizeof(protocol::ofp_port_stats)
+    };
+    sut.push(make_reply(1, more, 1, 2), now);
+    sut.push(make_reply(2, more, 1, 1), now);
+
+    BOOST_CHECK_THROW(
+        sut.push(make_reply(1, more, 3, 1), now), std::length_error);
+    BOOST_TEST(!sut.contains(1));
+    BOOST_TEST(sut.contains(2));
+    BOOST_TEST(sut.byte_length() == sizeof(protocol::ofp_port_stats));
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // multipart_reassembler
+BOOST_AUTO_TEST_SUITE_END() // utility_test
@@ -0,0 +1,153 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/utility/multipart_splitter.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <canard/net/ofp/v13/message/multipart/port_stats.hpp>
+#include <canard/net/ofp/v13/message/multipart/table_features.hpp>
+#include <canard/net/ofp/v13/utility/table_feature_property_set.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace multipart = v13::messages::multipart;
+namespace protocol = v13::protocol;
+
+namespace {
+
+  using body_type = multipart::port_stats_reply::body_type;
+
+  constexpr std::uint16_t port_stats_length = sizeof(protocol::ofp_port_stats);
+  constexpr std::uint16_t header_length
+    = sizeof(protocol::ofp_multipart_reply);
+
+  auto make_body(std::uint32_t const num_ports)
+    -> body_type
+  {
+    auto body = body_type{};
+    for (auto i = std::uint32_t{0}; i < num_ports; ++i) {
+      body.push_back(multipart::port_stats{
+          i + 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, v13::elapsed_time{1, 2}
+      });
+    }
+    return body;
+  }
+
+  auto port_numbers(std::vector<multipart::port_stats_reply> const& replies)
+    -> std::vector<std::uint32_t>
+  {
+    auto port_nos = std::vector<std::uint32_t>{};
+    for (auto const& reply : replies) {
+      for (auto const& port_stats : reply.body()) {
+        port_nos.push_back(port_stats.port_no());
+      }
+    }
+    return port_nos;
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(split_multipart)
+
+  BOOST_AUTO_TEST_CASE(returns_single_message_if_body_fits)
+  {
+    auto const replies = v13::split_multipart<multipart::port_stats_reply>(
+        make_body(3), 0x12345678);
+
+    BOOST_TEST_REQUIRE(replies.size() == 1);
+    BOOST_TEST(replies[0].xid() == 0x12345678);
+    BOOST_TEST(replies[0].flags() == 0);
+    BOOST_TEST(replies[0].length() == header_length + 3 * port_stats_length);
+  }
+  BOOST_AUTO_TEST_CASE(returns_single_message_if_body_is_empty)
+  {
+    auto const replies = v13::split_multipart<multipart::port_stats_reply>(
+        body_type{}, 1);
+
+    BOOST_TEST_REQUIRE(replies.size() == 1);
+    BOOST_TEST(replies[0].flags() == 0);
+    BOOST_TEST(replies[0].body().empty());
+  }
+  BOOST_AUTO_TEST_CASE(fills_each_message_up_to_max_length)
+  {
+    auto const replies = v13::split_multipart<multipart::port_stats_reply>(
+        make_body(8), 1, header_length + 3 * port_stats_length + 1);
+
+    BOOST_TEST_REQUIRE(replies.size() == 3);
+    BOOST_TEST(replies[0].body().size() == 3);
+    BOOST_TEST(replies[1].body().size() == 3);
+    BOOST_TEST(replies[2].body().size() == 2);
+    BOOST_TEST(replies[0].flags() == protocol::OFPMPF_REPLY_MORE);
+    BOOST_TEST(replies[1].flags() == protocol::OFPMPF_REPLY_MORE);
+    BOOST_TEST(replies[2].flags() == 0);
+    BOOST_TEST(replies[2].xid() == 1);
+    BOOST_TEST(port_numbers(replies)
+            == (std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6, 7, 8})
+             , boost::test_tools::per_element{});
+  }
+  BOOST_AUTO_TEST_CASE(splits_body_longer_than_ofp_length)
+  {
+    // 65535 - 16 bytes hold 584 port stats
+    auto const replies = v13::split_multipart<multipart::port_stats_reply>(
+        make_body(1200), 1);
+
+    BOOST_TEST_REQUIRE(replies.size() == 3);
+    BOOST_TEST(replies[0].length() == header_length + 584 * port_stats_length);
+    BOOST_TEST(replies[1].length() == header_length + 584 * port_stats_length);
+    BOOST_TEST(replies[2].length() == header_length + 32 * port_stats_length);
+    BOOST_TEST(port_numbers(replies).size() == 1200);
+  }
+  BOOST_AUTO_TEST_CASE(sets_req_more_for_request)
+  {
+    auto body = multipart::table_features_request::body_type{};
+    for (auto i = 0; i < 3; ++i) {
+      body.push_back(multipart::table_features{
+          std::uint8_t(i), "", 0, 0, 0, 0, v13::table_feature_property_set{}
+      });
+    }
+
+    auto const requests
+      = v13::split_multipart<multipart::table_features_request>(
+          std::move(body), 1, sizeof(protocol::ofp_multipart_request)
+                            + 2 * sizeof(protocol::ofp_table_features));
+
+    BOOST_TEST_REQUIRE(requests.size() == 2);
+    BOOST_TEST(requests[0].flags() == protocol::OFPMPF_REQ_MORE);
+    BOOST_TEST(requests[0].body().size() == 2);
+    BOOST_TEST(requests[1].flags() == 0);
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_element_does_not_fit)
+  {
+    BOOST_CHECK_THROW(
+          v13::split_multipart<multipart::port_stats_reply>(
+            make_body(1), 1, header_length + port_stats_length - 1)
+        , std::runtime_error);
+  }
+  BOOST_AUTO_TEST_CASE(leaves_body_intact_if_later_element_does_not_fit)
+  {
+    auto body = multipart::table_features_request::body_type{};
+    for (auto i = 0; i < 2; ++i) {
+      body.push_back(multipart::table_features{
+          std::uint8_t(i), "", 0, 0, 0, 0, v13::table_feature_property_set{}
+      });
+    }
+    body.push_back(multipart::table_features{
+        2, "", 0, 0, 0, 0, v13::table_feature_property_set{
+          v13::table_feature_properties::next_tables{1, 2, 3}
+        }
+    });
+    auto const expected = body;
+
+    BOOST_CHECK_THROW(
+          v13::split_multipart<multipart::table_features_request>(
+              std::move(body), 1, sizeof(protocol::ofp_multipart_request)
+                                + sizeof(protocol::ofp_table_features))
+        , std::runtime_error);
+    BOOST_TEST((body == expected));
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // split_multipart
+BOOST_AUTO_TEST_SUITE_END() // utility_test
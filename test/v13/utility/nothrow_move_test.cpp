@@ -0,0 +1,201 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/messages.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <canard/net/ofp/v13/action_list.hpp>
+#include <canard/net/ofp/v13/actions.hpp>
+#include <canard/net/ofp/v13/any_action.hpp>
+#include <canard/net/ofp/v13/any_hello_element.hpp>
+#include <canard/net/ofp/v13/any_instruction.hpp>
+#include <canard/net/ofp/v13/any_meter_band.hpp>
+#include <canard/net/ofp/v13/any_oxm_match_field.hpp>
+#include <canard/net/ofp/v13/any_queue_property.hpp>
+#include <canard/net/ofp/v13/any_table_feature_property.hpp>
+#include <canard/net/ofp/v13/common/oxm_match.hpp>
+#include <canard/net/ofp/v13/hello_elements.hpp>
+#include <canard/net/ofp/v13/instructions.hpp>
+#include <canard/net/ofp/v13/message/flow_add.hpp>
+#include <canard/net/ofp/v13/message/flow_delete.hpp>
+#include <canard/net/ofp/v13/message/flow_modify.hpp>
+#include <canard/net/ofp/v13/message/group_add.hpp>
+#include <canard/net/ofp/v13/message/hello.hpp>
+#include <canard/net/ofp/v13/meter_bands.hpp>
+#include <canard/net/ofp/v13/queue_properties.hpp>
+#include <canard/net/ofp/v13/table_feature_properties.hpp>
+#include <canard/net/ofp/v13/utility/action_set.hpp>
+#include <canard/net/ofp/v13/utility/instruction_set.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+
+namespace {
+
+  // Types which are not in any default list but are stored in containers.
+  using owning_types = std::tuple<
+      v13::messages::hello
+    , v13::messages::flow_add
+    , v13::messages::flow_modify
+    , v13::messages::flow_delete
+    , v13::messages::group_add
+    , v13::oxm_match
+    , v13::flow_entry
+    , v13::action_list
+    , v13::action_set
+    , v13::instruction_set
+    , v13::any_action
+    , v13::any_instruction
+    , v13::any_oxm_match_field
+    , v13::any_table_feature_property
+    , v13::any_queue_property
+    , v13::any_hello_element
+    , v13::any_meter_band
+  >;
+
+  // Types which own an ofp::list. The list allocator does not propagate
+  // its memory resource on move assignment, as in std::pmr, so assigning a
+  // list bound to another resource moves the elements one by one and may
+  // allocate. Move assignment of these types is therefore not noexcept;
+  // move construction still is.
+  using list_owning_types = std::tuple<
+      v13::messages::hello
+    , v13::messages::packet_in
+    , v13::messages::flow_removed
+    , v13::messages::queue_get_config_reply
+    , v13::messages::packet_out
+    , v13::messages::flow_add
+    , v13::messages::flow_modify
+    , v13::messages::flow_delete
+    , v13::messages::group_add
+    , v13::messages::multipart::flow_stats_request
+    , v13::messages::multipart::flow_stats_reply
+    , v13::messages::multipart::aggregate_stats_request
+    , v13::messages::multipart::table_stats_reply
+    , v13::messages::multipart::port_stats_reply
+    , v13::messages::multipart::queue_stats_reply
+    , v13::messages::multipart::group_stats_reply
+    , v13::messages::multipart::group_description_reply
+    , v13::messages::multipart::meter_stats_reply
+    , v13::messages::multipart::meter_config_reply
+    , v13::messages::multipart::table_features_request
+    , v13::messages::multipart::table_features_reply
+    , v13::messages::multipart::port_description_reply
+    , v13::instructions::write_actions
+    , v13::instructions::apply_actions
+    , v13::instructions::clear_actions
+    , v13::table_feature_properties::instructions
+    , v13::table_feature_properties::instructions_miss
+    , v13::table_feature_properties::next_tables
+    , v13::table_feature_properties::next_tables_miss
+    , v13::table_feature_properties::write_actions
+    , v13::table_feature_properties::write_actions_miss
+    , v13::table_feature_properties::apply_actions
+    , v13::table_feature_properties::apply_actions_miss
+    , v13::table_feature_properties::match
+    , v13::table_feature_properties::wildcards
+    , v13::table_feature_properties::write_setfield
+    , v13::table_feature_properties::write_setfield_miss
+    , v13::table_feature_properties::apply_setfield
+    , v13::table_feature_properties::apply_setfield_miss
+    , v13::hello_elements::versionbitmap
+    , v13::oxm_match
+    , v13::flow_entry
+    , v13::action_list
+    , v13::action_set
+    , v13::instruction_set
+    , v13::any_instruction
+    , v13::any_table_feature_property
+    , v13::any_hello_element
+  >;
+
+  template <class T, class Tuple>
+  struct is_one_of
+    : std::false_type
+  {};
+
+  template <class T, class U, class... Us>
+  struct is_one_of<T, std::tuple<U, Us...>>
+    : std::conditional<
+          std::is_same<T, U>::value
+        , std::true_type, is_one_of<T, std::tuple<Us...>>
+      >::type
+  {};
+
+  template <class T>
+  void check_nothrow_move()
+  {
+    static_assert(
+          std::is_nothrow_move_constructible<T>::value
+        , "move constructor must be noexcept");
+    static_assert(
+          std::is_nothrow_move_assignable<T>::value
+       != is_one_of<T, list_owning_types>::value
+        , "move assignment must be noexcept unless the type owns a list");
+  }
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_AUTO_TEST_SUITE(nothrow_move)
+
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      switch_message, T, v13::default_switch_message_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      controller_message, T, v13::default_controller_message_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      multipart_reply, T, v13::default_multipart_reply_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      multipart_request, T, v13::default_multipart_request_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(action, T, v13::default_all_action_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(instruction, T, v13::default_instruction_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      oxm_match_field, T, v13::default_oxm_match_field_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      table_feature_property, T, v13::default_table_feature_property_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      queue_property, T, v13::default_queue_property_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(
+      hello_element, T, v13::default_hello_element_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(meter_band, T, v13::default_meter_band_list)
+  {
+    check_nothrow_move<T>();
+  }
+  BOOST_AUTO_TEST_CASE_TEMPLATE(owning_type, T, owning_types)
+  {
+    check_nothrow_move<T>();
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // nothrow_move
+BOOST_AUTO_TEST_SUITE_END() // utility_test
@@ -0,0 +1,191 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/parallel_decode.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include <canard/net/ofp/memory_resource.hpp>
+#include <canard/net/ofp/v13/actions.hpp>
+#include <canard/net/ofp/v13/exception.hpp>
+#include <canard/net/ofp/v13/instructions.hpp>
+#include <canard/net/ofp/v13/message/multipart/flow_stats.hpp>
+#include <canard/net/ofp/v13/utility/instruction_set.hpp>
+
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace match = v13::oxm_match_fields;
+namespace multipart = v13::messages::multipart;
+
+namespace {
+
+  using body_type = multipart::flow_stats_reply::body_type;
+
+  // elements of different lengths
+  auto make_body(std::size_t const num_elements)
+    -> body_type
+  {
+    auto body = body_type{};
+    for (auto i = std::uint32_t{0}; i < num_elements; ++i) {
+      auto match = i % 3 == 0
+        ? v13::oxm_match{match::in_port{i + 1}, match::eth_type{0x0800}}
+        : v13::oxm_match{match::in_port{i + 1}};
+      auto instructions = v13::instruction_set{};
+      if (i % 2 == 0) {
+        instructions.insert(v13::instructions::apply_actions{
+            v13::actions::output{i + 1}
+        });
+      }
+      body.push_back(multipart::flow_stats{
+          v13::flow_entry{std::move(match), 1, i, std::move(instructions)}
+        , 0, 0, v13::timeouts{0, 0}, v13::elapsed_time{i, 0}
+        , v13::counters{i, i}
+      });
+    }
+    return body;
+  }
+
+  auto encode(body_type const& body)
+    -> std::vector<unsigned char>
+  {
+    auto buffer = std::vector<unsigned char>{};
+    body.encode(buffer);
+    return buffer;
+  }
+
+  // records the thread of each allocation and deallocation
+  class thread_recording_resource final
+    : public ofp::memory_resource
+  {
+  public:
+    auto thread_ids() const
+      -> std::vector<std::thread::id>
+    {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      return thread_ids_;
+    }
+
+  private:
+    auto do_allocate(std::size_t const bytes, std::size_t)
+      -> void* override
+    {
+      record();
+      return ::operator new(bytes);
+    }
+
+    void do_deallocate(void* const ptr, std::size_t, std::size_t) override
+    {
+      record();
+      ::operator delete(ptr);
+    }
+
+    void record()
+    {
+      std::lock_guard<std::mutex> const lock{mutex_};
+      thread_ids_.push_back(std::this_thread::get_id());
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<std::thread::id> thread_ids_;
+  };
+
+  struct parallel_decode_fixture
+  {
+    body_type body = make_body(100);
+    std::vector<unsigned char> bin = encode(body);
+  };
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_FIXTURE_TEST_SUITE(parallel_decode, parallel_decode_fixture)
+
+  BOOST_AUTO_TEST_CASE(decodes_elements_in_order)
+  {
+    unsigned char const* it = bin.data();
+
+    auto const result = ofp::parallel_decode<body_type>(
+        it, bin.data() + bin.size(), 4);
+
+    BOOST_TEST((it == bin.data() + bin.size()));
+    BOOST_TEST_REQUIRE(result.size() == body.size());
+    BOOST_TEST((result == body));
+    BOOST_TEST(result.byte_length() == bin.size());
+  }
+  BOOST_AUTO_TEST_CASE(uses_scoped_resource_only_on_calling_thread)
+  {
+    thread_recording_resource resource{};
+    unsigned char const* it = bin.data();
+
+    {
+      ofp::scoped_memory_resource const scope{resource};
+      auto const result = ofp::parallel_decode<body_type>(
+          it, bin.data() + bin.size(), 4);
+
+      BOOST_TEST(result.get_allocator().resource() == &resource);
+      BOOST_TEST((result == body));
+    }
+
+    auto const thread_ids = resource.thread_ids();
+    BOOST_TEST(!thread_ids.empty());
+    for (auto const& id : thread_ids) {
+      BOOST_TEST((id == std::this_thread::get_id()));
+    }
+  }
+  BOOST_AUTO_TEST_CASE(decodes_on_calling_thread_if_single_thread)
+  {
+    unsigned char const* it = bin.data();
+
+    auto const result = ofp::parallel_decode<body_type>(
+        it, bin.data() + bin.size(), 1);
+
+    BOOST_TEST((result == body));
+  }
+  BOOST_AUTO_TEST_CASE(decodes_if_threads_outnumber_elements)
+  {
+    auto const body = make_body(3);
+    auto const bin = encode(body);
+    unsigned char const* it = bin.data();
+
+    auto const result = ofp::parallel_decode<body_type>(
+        it, bin.data() + bin.size(), 8);
+
+    BOOST_TEST((result == body));
+  }
+  BOOST_AUTO_TEST_CASE(decodes_empty_range)
+  {
+    unsigned char const* it = bin.data();
+
+    auto const result = ofp::parallel_decode<body_type>(it, it, 4);
+
+    BOOST_TEST(result.empty());
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_element_is_invalid)
+  {
+    // truncates the match of the last element
+    auto const last_length = std::size_t(body.back().length());
+    auto const match_length_pos
+      = bin.size() - last_length + sizeof(v13::protocol::ofp_flow_stats) + 3;
+    bin[match_length_pos] = 0x00;
+    unsigned char const* it = bin.data();
+
+    BOOST_CHECK_THROW(
+          ofp::parallel_decode<body_type>(it, bin.data() + bin.size(), 4)
+        , v13::exception);
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_lengths_do_not_chain_up)
+  {
+    unsigned char const* it = bin.data();
+
+    BOOST_CHECK_THROW(
+          ofp::parallel_decode<body_type>(it, bin.data() + bin.size() - 1, 4)
+        , std::exception);
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // parallel_decode
+BOOST_AUTO_TEST_SUITE_END() // utility_test
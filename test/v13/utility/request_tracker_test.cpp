@@ -0,0 +1,208 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/v13/utility/request_tracker.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <canard/net/ofp/data_type.hpp>
+#include <canard/net/ofp/v13/message/barrier.hpp>
+#include <canard/net/ofp/v13/message/echo.hpp>
+#include <canard/net/ofp/v13/message/error.hpp>
+#include <canard/net/ofp/v13/message/multipart/port_stats.hpp>
+#include <canard/net/ofp/v13/message/table_mod.hpp>
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace messages = v13::messages;
+namespace multipart = messages::multipart;
+namespace protocol = v13::protocol;
+
+namespace {
+
+  using tracker = v13::request_tracker<>;
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+
+  constexpr auto more = std::uint16_t{protocol::OFPMPF_REPLY_MORE};
+
+  struct tracker_fixture
+  {
+    tracker sut{seconds{5}, 100};
+    tracker::time_point now{};
+  };
+
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_FIXTURE_TEST_SUITE(request_tracker, tracker_fixture)
+
+  BOOST_AUTO_TEST_CASE(allocates_consecutive_xids_from_initial_xid)
+  {
+    BOOST_TEST(sut.next_xid() == 100);
+    BOOST_TEST(sut.next_xid() == 101);
+    BOOST_TEST(sut.next_xid() == 102);
+  }
+  BOOST_AUTO_TEST_CASE(resolves_reply_to_request)
+  {
+    sut.track(messages::echo_request{sut.next_xid()}, now);
+
+    auto const result
+      = sut.resolve(messages::echo_reply{100}, now + milliseconds{3});
+
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST(result->xid == 100);
+    BOOST_TEST(result->request_type == protocol::OFPT_ECHO_REQUEST);
+    BOOST_TEST((result->round_trip_time == milliseconds{3}));
+    BOOST_TEST(!result->failed);
+    BOOST_TEST(sut.empty());
+  }
+  BOOST_AUTO_TEST_CASE(does_not_resolve_reply_of_other_type)
+  {
+    sut.track(messages::echo_request{1}, now);
+
+    BOOST_TEST(!sut.resolve(messages::barrier_reply{1}, now));
+    BOOST_TEST(!sut.resolve(messages::echo_reply{2}, now));
+    BOOST_TEST(sut.contains(1));
+  }
+  BOOST_AUTO_TEST_CASE(resolves_multipart_request_by_last_reply)
+  {
+    sut.track(multipart::port_stats_request{protocol::OFPP_ANY, 1}, now);
+
+    BOOST_TEST(!sut.resolve(multipart::port_stats_reply{{}, more, 1}, now));
+    BOOST_TEST(sut.contains(1));
+    auto const result = sut.resolve(multipart::port_stats_reply{{}, 0, 1}, now);
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST(result->request_type == protocol::OFPT_MULTIPART_REQUEST);
+    BOOST_TEST(!sut.contains(1));
+  }
+  BOOST_AUTO_TEST_CASE(keeps_first_time_of_request_split_by_req_more)
+  {
+    sut.track(1, protocol::OFPT_MULTIPART_REQUEST, now);
+    sut.track(1, protocol::OFPT_MULTIPART_REQUEST, now + seconds{1});
+
+    auto const result = sut.resolve(
+        multipart::port_stats_reply{{}, 0, 1}, now + seconds{2});
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST((result->round_trip_time == seconds{2}));
+  }
+  BOOST_AUTO_TEST_CASE(resolves_error_by_echoed_request_header)
+  {
+    auto const request = messages::table_mod{1, 0, 7};
+    sut.track(request, now);
+
+    auto const result = sut.resolve(
+          messages::error{protocol::bad_request_code::bad_type, request}
+        , now + seconds{1});
+
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST(result->xid == 7);
+    BOOST_TEST(result->request_type == protocol::OFPT_TABLE_MOD);
+    BOOST_TEST(result->failed);
+    BOOST_TEST(sut.statistics(protocol::OFPT_TABLE_MOD).num_failed == 1);
+  }
+  BOOST_AUTO_TEST_CASE(resolves_error_without_data_by_its_xid)
+  {
+    sut.track(messages::echo_request{7}, now);
+
+    auto const result = sut.resolve(
+          messages::error{
+            protocol::OFPET_BAD_REQUEST, 0, ofp::data_type{}, 7
+          }
+        , now);
+
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST(result->request_type == protocol::OFPT_ECHO_REQUEST);
+    BOOST_TEST(result->failed);
+  }
+  BOOST_AUTO_TEST_CASE(does_not_resolve_error_echoing_other_request_type)
+  {
+    sut.track(messages::echo_request{7}, now);
+
+    BOOST_TEST(!sut.resolve(
+          messages::error{
+            protocol::bad_request_code::bad_type, messages::table_mod{1, 0, 7}
+          }
+        , now));
+    BOOST_TEST(sut.contains(7));
+  }
+  BOOST_AUTO_TEST_CASE(barrier_reply_completes_earlier_requests_without_reply)
+  {
+    sut.track(messages::table_mod{1, 0, 1}, now);
+    sut.track(messages::echo_request{2}, now);
+    sut.track(messages::barrier_request{3}, now);
+    sut.track(messages::table_mod{1, 0, 4}, now);
+
+    auto const result
+      = sut.resolve(messages::barrier_reply{3}, now + seconds{1});
+
+    BOOST_TEST_REQUIRE(bool(result));
+    BOOST_TEST(result->request_type == protocol::OFPT_BARRIER_REQUEST);
+    BOOST_TEST(!sut.contains(1));
+    BOOST_TEST(sut.contains(2));
+    BOOST_TEST(sut.contains(4));
+    BOOST_TEST(sut.statistics(protocol::OFPT_TABLE_MOD).count == 1);
+    BOOST_TEST(sut.statistics(protocol::OFPT_TABLE_MOD).num_failed == 0);
+  }
+  BOOST_AUTO_TEST_CASE(keeps_round_trip_time_statistics_per_request_type)
+  {
+    sut.track(messages::echo_request{1}, now);
+    sut.track(messages::echo_request{2}, now);
+    sut.track(messages::echo_request{3}, now);
+    sut.track(messages::barrier_request{4}, now);
+    sut.resolve(messages::echo_reply{1}, now + seconds{1});
+    sut.resolve(messages::echo_reply{2}, now + seconds{5});
+    sut.resolve(messages::echo_reply{3}, now + seconds{3});
+    sut.resolve(messages::barrier_reply{4}, now + seconds{2});
+
+    auto const& echo = sut.statistics(protocol::OFPT_ECHO_REQUEST);
+    BOOST_TEST(echo.count == 3);
+    BOOST_TEST((echo.min == seconds{1}));
+    BOOST_TEST((echo.max == seconds{5}));
+    BOOST_TEST((echo.mean() == seconds{3}));
+    auto const& barrier = sut.statistics(protocol::OFPT_BARRIER_REQUEST);
+    BOOST_TEST(barrier.count == 1);
+    BOOST_TEST((barrier.mean() == seconds{2}));
+  }
+  BOOST_AUTO_TEST_CASE(expire_discards_requests_after_timeout)
+  {
+    sut.track(messages::echo_request{1}, now);
+    sut.track(messages::echo_request{2}, now + seconds{3});
+
+    BOOST_TEST(sut.expire(now + seconds{5}) == 1);
+
+    BOOST_TEST(!sut.contains(1));
+    BOOST_TEST(sut.contains(2));
+    auto const& echo = sut.statistics(protocol::OFPT_ECHO_REQUEST);
+    BOOST_TEST(echo.num_expired == 1);
+    BOOST_TEST(echo.count == 0);
+    BOOST_TEST(!sut.resolve(messages::echo_reply{1}, now + seconds{5}));
+  }
+  BOOST_AUTO_TEST_CASE(abort_discards_request)
+  {
+    sut.track(messages::echo_request{1}, now);
+
+    BOOST_TEST(sut.abort(1));
+    BOOST_TEST(!sut.abort(1));
+    BOOST_TEST(sut.empty());
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_xid_is_used_by_other_request_type)
+  {
+    sut.track(messages::echo_request{1}, now);
+
+    BOOST_CHECK_THROW(
+        sut.track(messages::barrier_request{1}, now), std::invalid_argument);
+  }
+  BOOST_AUTO_TEST_CASE(throws_exception_if_too_many_requests)
+  {
+    auto sut = tracker{seconds{5}, 0, 2};
+    sut.track(messages::echo_request{1}, now);
+    sut.track(messages::echo_request{2}, now);
+
+    BOOST_CHECK_THROW(
+        sut.track(messages::echo_request{3}, now), std::length_error);
+    BOOST_TEST(sut.size() == 2);
+  }
+
+BOOST_AUTO_TEST_SUITE_END() // request_tracker
+BOOST_AUTO_TEST_SUITE_END() // utility_test
@@ -0,0 +1,151 @@
+#define BOOST_TEST_DYN_LINK
+#include <canard/net/ofp/stream_framer.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <boost/optional/optional.hpp>
+#include <canard/net/ofp/v13/decoder/message_decoder.hpp>
+#include "../../test_utility.hpp"
+
+namespace ofp = canard::net::ofp;
+namespace v13 = ofp::v13;
+namespace msg = v13::messages;
+
+namespace {
+  struct stream_framer_fixture
+  {
+    ofp::stream_framer sut{v13::protocol::OFP_VERSION};
+    std::vector<unsigned char> barrier_reply_bin
+      = "\x04\x15\x00\x08\x01\x02\x03\x04"_bin;
+    std::vector<unsigned char> echo_request_bin
+      = "\x04\x02\x00\x0b\x05\x06\x07\x08""\x01\x02\x03"_bin;
+  };
+
+  auto to_vector(ofp::stream_framer::message_range const& range)
+    -> std::vector<unsigned char>
+  {
+    return std::vector<unsigned char>(range.begin(), range.end());
+  }
+
+  template <class T>
+  struct to_optional
+  {
+    using result_type = boost::optional<T>;
+    auto operator()(T const& t) const -> result_type
+    { return result_type{t}; }
+    template <class U>
+    auto operator()(U const&) const -> result_type
+    { return boost::none; }
+  };
+}
+
+BOOST_AUTO_TEST_SUITE(utility_test)
+BOOST_FIXTURE_TEST_SUITE(stream_framer, stream_framer_fixture)
+  BOOST_AUTO_TEST_CASE(is_empty_when_constructed)
+  {
+    BOOST_TEST(sut.size() == 0);
+    BOOST_TEST(sut.next().empty());
+    BOOST_TEST((sut.error() == ofp::framer_error::none));
+  }
+  BOOST_AUTO_TEST_CASE(yields_nothing_until_message_is_complete)
+  {
+    sut.feed(echo_request_bin.data(), 4);
+    BOOST_TEST(sut.next().empty());
+    sut.feed(echo_request_bin.data() + 4, echo_request_bin.size() - 5);
+    BOOST_TEST(sut.next().empty());
+
+    sut.feed(&echo_request_bin.back(), 1);
+
+    auto const message = sut.next();
+    BOOST_TEST(to_vector(message) == echo_request_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.size() == 0);
+  }
+  BOOST_AUTO_TEST_CASE(yields_each_message_in_chunk)
+  {
+    auto bin = barrier_reply_bin;
+    bin.insert(bin.end(), echo_request_bin.begin(), echo_request_bin.end());
+
+    BOOST_TEST(sut.feed(bin.data(), bin.size()) == bin.size());
+
+    BOOST_TEST(to_vector(sut.next()) == barrier_reply_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(to_vector(sut.next()) == echo_request_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.next().empty());
+  }
+  BOOST_AUTO_TEST_CASE(reads_directly_into_prepared_buffer)
+  {
+    auto const buffer = sut.prepare();
+    BOOST_TEST_REQUIRE(buffer.size() >= barrier_reply_bin.size());
+
+    std::copy(barrier_reply_bin.begin(), barrier_reply_bin.end()
+            , buffer.begin());
+    sut.commit(barrier_reply_bin.size());
+
+    auto const message = sut.next();
+    BOOST_TEST((message.begin() == buffer.begin()));
+    BOOST_TEST(message.size() == barrier_reply_bin.size());
+  }
+  BOOST_AUTO_TEST_CASE(linearizes_message_wrapping_ring_buffer)
+  {
+    auto sut = ofp::stream_framer{v13::protocol::OFP_VERSION, 0x10000};
+    auto bin = std::vector<unsigned char>(0xfffc);
+    bin[0] = 0x04;
+    bin[2] = 0xff;
+    bin[3] = 0xfc;
+    bin.insert(bin.end(), barrier_reply_bin.begin(), barrier_reply_bin.end());
+
+    auto const consumed = sut.feed(bin.data(), bin.size());
+    BOOST_TEST(consumed == 0x10000);
+    BOOST_TEST(sut.next().size() == 0xfffc);
+    sut.feed(bin.data() + consumed, bin.size() - consumed);
+
+    auto const message = sut.next();
+    BOOST_TEST(to_vector(message) == barrier_reply_bin
+             , boost::test_tools::per_element{});
+    BOOST_TEST(sut.size() == 0);
+  }
+  BOOST_AUTO_TEST_CASE(yields_message_which_can_be_decoded)
+  {
+    sut.feed(echo_request_bin.data(), echo_request_bin.size());
+    auto const message = sut.next();
+    auto it = message.begin();
+    using f = to_optional<msg::echo_request>;
+
+    auto const echo = v13::message_decoder::decode<f::result_type>(
+        it, message.end(), f{});
+
+    BOOST_TEST_REQUIRE(bool(echo));
+    BOOST_TEST(echo->xid() == 0x05060708);
+    BOOST_TEST((it == message.end()));
+  }
+  BOOST_AUTO_TEST_CASE(accepts_hello_of_other_version)
+  {
+    auto const hello_bin = "\x01\x00\x00\x08\x00\x00\x00\x01"_bin;
+
+    sut.feed(hello_bin.data(), hello_bin.size());
+
+    BOOST_TEST(sut.next().size() == hello_bin.size());
+  }
+  BOOST_AUTO_TEST_CASE(reports_error_if_version_is_unexpected)
+  {
+    barrier_reply_bin[0] = 0x01;
+
+    sut.feed(barrier_reply_bin.data(), barrier_reply_bin.size());
+
+    BOOST_TEST(sut.next().empty());
+    BOOST_TEST((sut.error() == ofp::framer_error::bad_version));
+  }
+  BOOST_AUTO_TEST_CASE(reports_error_if_length_is_smaller_than_header)
+  {
+    barrier_reply_bin[3] = 0x07;
+
+    sut.feed(barrier_reply_bin.data(), barrier_reply_bin.size());
+
+    BOOST_TEST(sut.next().empty());
+    BOOST_TEST((sut.error() == ofp::framer_error::bad_length));
+  }
+BOOST_AUTO_TEST_SUITE_END() // stream_framer
+BOOST_AUTO_TEST_SUITE_END() // utility_test